@@ -1,6 +1,15 @@
 #pragma once
  
 #include "Modules/ModuleManager.h"
+#include "HAL/LowLevelMemTracker.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+// Low level memory tag for everything the session proxies allocate
+LLM_DECLARE_TAG_API(AdvancedSessions, ADVANCEDSESSIONS_API);
+
+// Stats group for the session proxies, each proxy declares its own cycle stats in it
+DECLARE_STATS_GROUP(TEXT("AdvancedSessions"), STATGROUP_AdvancedSessions, STATCAT_Advanced);
 
 class AdvancedSessions : public IModuleInterface
 {
@@ -1,6 +1,8 @@
 //#include "StandAlonePrivatePCH.h"
 #include "AdvancedSessions.h"
 
+LLM_DEFINE_TAG(AdvancedSessions);
+
 void AdvancedSessions::StartupModule()
 {
 }
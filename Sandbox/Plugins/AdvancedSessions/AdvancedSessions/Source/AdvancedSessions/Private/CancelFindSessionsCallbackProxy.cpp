@@ -1,5 +1,8 @@
 // Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
 #include "CancelFindSessionsCallbackProxy.h"
+#include "AdvancedSessions.h"
+
+DECLARE_CYCLE_STAT(TEXT("Cancel Find Sessions Completed"), STAT_CancelFindSessionsCompleted, STATGROUP_AdvancedSessions);
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -21,6 +24,8 @@ UCancelFindSessionsCallbackProxy* UCancelFindSessionsCallbackProxy::CancelFindSe
 
 void UCancelFindSessionsCallbackProxy::Activate()
 {
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("CancelFindSessions"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 	Helper.QueryIDFromPlayerController(PlayerControllerWeakPtr.Get());
 
@@ -47,6 +52,10 @@ void UCancelFindSessionsCallbackProxy::Activate()
 
 void UCancelFindSessionsCallbackProxy::OnCompleted(bool bWasSuccessful)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCancelFindSessionsCallbackProxy::OnCompleted);
+	SCOPE_CYCLE_COUNTER(STAT_CancelFindSessionsCompleted);
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("CancelFindSessionsCallback"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 	Helper.QueryIDFromPlayerController(PlayerControllerWeakPtr.Get());
 
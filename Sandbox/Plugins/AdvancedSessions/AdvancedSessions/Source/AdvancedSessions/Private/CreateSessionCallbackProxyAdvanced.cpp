@@ -1,5 +1,9 @@
 // Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
 #include "CreateSessionCallbackProxyAdvanced.h"
+#include "AdvancedSessions.h"
+
+DECLARE_CYCLE_STAT(TEXT("Create Session Completed"), STAT_CreateSessionCompleted, STATGROUP_AdvancedSessions);
+DECLARE_CYCLE_STAT(TEXT("Create Session Start Completed"), STAT_CreateSessionStartCompleted, STATGROUP_AdvancedSessions);
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -38,6 +42,8 @@ UCreateSessionCallbackProxyAdvanced* UCreateSessionCallbackProxyAdvanced::Create
 
 void UCreateSessionCallbackProxyAdvanced::Activate()
 {
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("CreateSession"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 	
 	if (PlayerControllerWeakPtr.IsValid() )
@@ -121,6 +127,10 @@ void UCreateSessionCallbackProxyAdvanced::Activate()
 
 void UCreateSessionCallbackProxyAdvanced::OnCreateCompleted(FName SessionName, bool bWasSuccessful)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCreateSessionCallbackProxyAdvanced::OnCreateCompleted);
+	SCOPE_CYCLE_COUNTER(STAT_CreateSessionCompleted);
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("CreateSessionCallback"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 	//Helper.QueryIDFromPlayerController(PlayerControllerWeakPtr.Get());
 
@@ -159,6 +169,10 @@ void UCreateSessionCallbackProxyAdvanced::OnCreateCompleted(FName SessionName, b
 
 void UCreateSessionCallbackProxyAdvanced::OnStartCompleted(FName SessionName, bool bWasSuccessful)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UCreateSessionCallbackProxyAdvanced::OnStartCompleted);
+	SCOPE_CYCLE_COUNTER(STAT_CreateSessionStartCompleted);
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("StartSessionCallback"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 	//Helper.QueryIDFromPlayerController(PlayerControllerWeakPtr.Get());
 
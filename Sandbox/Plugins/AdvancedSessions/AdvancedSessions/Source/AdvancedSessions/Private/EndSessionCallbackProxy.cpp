@@ -1,5 +1,8 @@
 // Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
 #include "EndSessionCallbackProxy.h"
+#include "AdvancedSessions.h"
+
+DECLARE_CYCLE_STAT(TEXT("End Session Completed"), STAT_EndSessionCompleted, STATGROUP_AdvancedSessions);
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -21,6 +24,8 @@ UEndSessionCallbackProxy* UEndSessionCallbackProxy::EndSession(UObject* WorldCon
 
 void UEndSessionCallbackProxy::Activate()
 {
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("EndSession"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 	Helper.QueryIDFromPlayerController(PlayerControllerWeakPtr.Get());
 
@@ -55,6 +60,10 @@ void UEndSessionCallbackProxy::Activate()
 
 void UEndSessionCallbackProxy::OnCompleted(FName SessionName, bool bWasSuccessful)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UEndSessionCallbackProxy::OnCompleted);
+	SCOPE_CYCLE_COUNTER(STAT_EndSessionCompleted);
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("EndSessionCallback"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 	Helper.QueryIDFromPlayerController(PlayerControllerWeakPtr.Get());
 
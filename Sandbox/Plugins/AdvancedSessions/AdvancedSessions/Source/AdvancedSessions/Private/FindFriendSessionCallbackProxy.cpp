@@ -1,5 +1,8 @@
 // Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
 #include "FindFriendSessionCallbackProxy.h"
+#include "AdvancedSessions.h"
+
+DECLARE_CYCLE_STAT(TEXT("Find Friend Session Completed"), STAT_FindFriendSessionCompleted, STATGROUP_AdvancedSessions);
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -23,6 +26,8 @@ UFindFriendSessionCallbackProxy* UFindFriendSessionCallbackProxy::FindFriendSess
 
 void UFindFriendSessionCallbackProxy::Activate()
 {
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	if (!cUniqueNetId.IsValid())
 	{
 		// Fail immediately
@@ -82,6 +87,10 @@ void UFindFriendSessionCallbackProxy::Activate()
 
 void UFindFriendSessionCallbackProxy::OnFindFriendSessionCompleted(int32 LocalPlayer, bool bWasSuccessful, const TArray<FOnlineSessionSearchResult>& SessionInfo)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UFindFriendSessionCallbackProxy::OnFindFriendSessionCompleted);
+	SCOPE_CYCLE_COUNTER(STAT_FindFriendSessionCompleted);
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("EndSessionCallback"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 	Helper.QueryIDFromPlayerController(PlayerControllerWeakPtr.Get());
 
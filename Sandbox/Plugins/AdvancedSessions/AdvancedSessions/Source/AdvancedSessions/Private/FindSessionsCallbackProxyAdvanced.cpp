@@ -1,5 +1,8 @@
 // Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
 #include "FindSessionsCallbackProxyAdvanced.h"
+#include "AdvancedSessions.h"
+
+DECLARE_CYCLE_STAT(TEXT("Find Sessions Completed"), STAT_FindSessionsCompleted, STATGROUP_AdvancedSessions);
 
 #include "Online/OnlineSessionNames.h"
 
@@ -35,6 +38,8 @@ UFindSessionsCallbackProxyAdvanced* UFindSessionsCallbackProxyAdvanced::FindSess
 
 void UFindSessionsCallbackProxyAdvanced::Activate()
 {
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("FindSessions"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 	Helper.QueryIDFromPlayerController(PlayerControllerWeakPtr.Get());
 
@@ -172,6 +177,10 @@ void UFindSessionsCallbackProxyAdvanced::Activate()
 
 void UFindSessionsCallbackProxyAdvanced::OnCompleted(bool bSuccess)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UFindSessionsCallbackProxyAdvanced::OnCompleted);
+	SCOPE_CYCLE_COUNTER(STAT_FindSessionsCompleted);
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("FindSessionsCallback"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 	Helper.QueryIDFromPlayerController(PlayerControllerWeakPtr.Get());
 
@@ -1,4 +1,7 @@
 #include "StartSessionCallbackProxyAdvanced.h"
+#include "AdvancedSessions.h"
+
+DECLARE_CYCLE_STAT(TEXT("Start Session Completed"), STAT_StartSessionCompleted, STATGROUP_AdvancedSessions);
 
 UStartSessionCallbackProxyAdvanced::UStartSessionCallbackProxyAdvanced(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
@@ -16,6 +19,8 @@ UStartSessionCallbackProxyAdvanced* UStartSessionCallbackProxyAdvanced::StartAdv
 
 void UStartSessionCallbackProxyAdvanced::Activate()
 {
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	const FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("StartSession"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 
 	if (Helper.OnlineSub != nullptr)
@@ -36,6 +41,10 @@ void UStartSessionCallbackProxyAdvanced::Activate()
 
 void UStartSessionCallbackProxyAdvanced::OnStartCompleted(FName SessionName, bool bWasSuccessful)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UStartSessionCallbackProxyAdvanced::OnStartCompleted);
+	SCOPE_CYCLE_COUNTER(STAT_StartSessionCompleted);
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("StartSessionCallback"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 
 	if (Helper.OnlineSub != nullptr)
@@ -1,5 +1,8 @@
 // Copyright 1998-2015 Epic Games, Inc. All Rights Reserved.
 #include "UpdateSessionCallbackProxyAdvanced.h"
+#include "AdvancedSessions.h"
+
+DECLARE_CYCLE_STAT(TEXT("Update Session Completed"), STAT_UpdateSessionCompleted, STATGROUP_AdvancedSessions);
 
 
 //////////////////////////////////////////////////////////////////////////
@@ -30,6 +33,8 @@ UUpdateSessionCallbackProxyAdvanced* UUpdateSessionCallbackProxyAdvanced::Update
 
 void UUpdateSessionCallbackProxyAdvanced::Activate()
 {
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	const FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("UpdateSession"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 
 	if (Helper.OnlineSub != nullptr)
@@ -105,6 +110,10 @@ void UUpdateSessionCallbackProxyAdvanced::Activate()
 
 void UUpdateSessionCallbackProxyAdvanced::OnUpdateCompleted(FName SessionName, bool bWasSuccessful)
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UUpdateSessionCallbackProxyAdvanced::OnUpdateCompleted);
+	SCOPE_CYCLE_COUNTER(STAT_UpdateSessionCompleted);
+	LLM_SCOPE_BYTAG(AdvancedSessions);
+
 	const FOnlineSubsystemBPCallHelperAdvanced Helper(TEXT("UpdateSessionCallback"), GEngine->GetWorldFromContextObject(WorldContextObject.Get(), EGetWorldErrorMode::LogAndReturnNull));
 
 	if (Helper.OnlineSub != nullptr)
@@ -14,6 +14,7 @@
 #include "Interfaces/OnlineSessionInterface.h"
 #include "BlueprintDataDefinitions.h"
 #include "UObject/UObjectIterator.h"
+#include "HAL/LowLevelMemTracker.h"
 
 // This is taken directly from UE4 - OnlineSubsystemSteamPrivatePCH.h as a fix for the array_count macro
 // @todo Steam: Steam headers trigger secure-C-runtime warnings in Visual C++. Rather than mess with _CRT_SECURE_NO_WARNINGS, we'll just
@@ -238,6 +239,9 @@ public:
 //General Advanced Sessions Log
 DECLARE_LOG_CATEGORY_EXTERN(AdvancedSteamFriendsLog, Log, All);
 
+// Low level memory tag for avatar textures and their pixel buffers
+LLM_DECLARE_TAG_API(SteamAvatars, ADVANCEDSTEAMSESSIONS_API);
+
 UENUM(Blueprintable)
 enum class SteamAvatarSize : uint8
 {
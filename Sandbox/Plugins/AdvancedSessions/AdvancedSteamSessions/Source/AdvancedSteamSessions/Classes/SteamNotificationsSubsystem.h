@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "Subsystems/GameInstanceSubsystem.h"
+#include "SteamServiceSubsystem.h"
 
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 
@@ -81,7 +82,16 @@ void USteamNotificationsSubsystem::cSteamEventsStore::OnExternalUITriggered(Game
 {
 	if (ParentSubsystem)
 	{
-		ParentSubsystem->OnSteamOverlayActivated_Bind.Broadcast((bool)CallbackData->m_bActive);
+		// Steam may deliver this on the online subsystem's thread
+		TWeakObjectPtr<USteamNotificationsSubsystem> WeakParent(ParentSubsystem);
+		const bool bActive = (bool)CallbackData->m_bActive;
+		USteamServiceSubsystem::RunOnGameThread([WeakParent, bActive]()
+		{
+			if (WeakParent.IsValid())
+			{
+				WeakParent->OnSteamOverlayActivated_Bind.Broadcast(bActive);
+			}
+		});
 	}
 }
 #endif
\ No newline at end of file
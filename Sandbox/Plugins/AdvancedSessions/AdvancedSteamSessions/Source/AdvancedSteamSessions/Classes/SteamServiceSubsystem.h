@@ -0,0 +1,76 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SteamServiceSubsystem.generated.h"
+
+// Kept opaque here so including this header never drags in a second copy of the steam headers
+class ISteamFriends;
+class ISteamUGC;
+class ISteamUser;
+class ISteamUtils;
+
+DECLARE_LOG_CATEGORY_EXTERN(SteamServiceLog, Log, All);
+
+/**
+* Owns the Steam client for the whole plugin.
+*
+* Steam is initialized once (on whichever thread asks first) and the interface pointers are cached, so
+* the blueprint libraries no longer call SteamAPI_Init() on every node.
+*
+* Callbacks are pumped by exactly one owner. While OnlineSubsystemSteam is running it already pumps
+* SteamAPI_RunCallbacks() on its online async thread, so this subsystem leaves it alone. Otherwise it
+* pumps from the game thread at a fixed rate (AdvancedSteam.CallbackHz), under its own cycle stat.
+* Either way, handlers hand their results to blueprints through RunOnGameThread().
+*/
+UCLASS()
+class ADVANCEDSTEAMSESSIONS_API USteamServiceSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	/** Implement this for initialization of instances of the system */
+	virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	/** Implement this for deinitialization of instances of the system */
+	virtual void Deinitialize() override;
+
+	/**
+	* Initializes Steam if nobody has yet, otherwise waits for an initialization in progress to finish. Safe to call from any thread.
+	* A failed initialization (e.g. the Steam client wasn't running yet) is retried at most every few seconds.
+	* @param RestartAppId	If non zero, relaunches through the Steam client first when the game was not started from it
+	* @return Whether Steam is ready to use
+	*/
+	static bool InitializeSteam(uint32 RestartAppId = 0);
+
+	/** Cheap once Steam is up. Initializes it on first use if the game never called InitializeSteam(), and keeps retrying (throttled) while that fails. */
+	static bool IsSteamReady();
+
+	// Cached interfaces, only valid once IsSteamReady() has returned true
+	static ISteamFriends* GetSteamFriends();
+	static ISteamUGC* GetSteamUGC();
+	static ISteamUser* GetSteamUser();
+	static ISteamUtils* GetSteamUtils();
+
+	/** Runs Work now when called on the game thread, otherwise queues it there. For steam callback handlers, which may run on the online thread. */
+	static void RunOnGameThread(TUniqueFunction<void()> Work);
+
+	/** Whether OnlineSubsystemSteam is up, in which case it pumps callbacks on its own thread */
+	static bool IsOnlineSubsystemPumping();
+
+private:
+
+	bool PumpCallbacks(float DeltaTime);
+
+	FTSTicker::FDelegateHandle PumpHandle;
+
+	// Time since the last pump
+	float TimeSincePump = 0.0f;
+
+	// Only one game instance pumps when several exist (multi client PIE), Steam is process wide
+	static USteamServiceSubsystem* PumpOwner;
+};
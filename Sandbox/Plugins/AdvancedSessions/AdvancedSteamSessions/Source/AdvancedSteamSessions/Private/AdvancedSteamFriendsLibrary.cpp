@@ -1,9 +1,11 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 #include "AdvancedSteamFriendsLibrary.h"
 #include "OnlineSubSystemHeader.h"
+#include "SteamServiceSubsystem.h"
 
 //General Log
 DEFINE_LOG_CATEGORY(AdvancedSteamFriendsLog);
+LLM_DEFINE_TAG(SteamAvatars);
 
 
 // Clan functions, add in soon
@@ -17,7 +19,7 @@ DEFINE_LOG_CATEGORY(AdvancedSteamFriendsLog);
 		return 0;
 	}
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		uint64 id = *((uint64*)UniqueNetId.UniqueNetId->GetBytes());
 
@@ -49,7 +51,7 @@ DEFINE_LOG_CATEGORY(AdvancedSteamFriendsLog);
 		//virtual CSteamID GetClanOfficerByIndex(CSteamID steamIDClan, int iOfficer) = 0;
 
 
-		return SteamFriends()->GetFriendSteamLevel(id);
+		return USteamServiceSubsystem::GetSteamFriends()->GetFriendSteamLevel(id);
 	}
 #endif
 
@@ -61,13 +63,13 @@ void UAdvancedSteamFriendsLibrary::GetSteamGroups(TArray<FBPSteamGroupInfo> & St
 	
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
-		int numClans = SteamFriends()->GetClanCount();
+		int numClans = USteamServiceSubsystem::GetSteamFriends()->GetClanCount();
 
 		for (int i = 0; i < numClans; i++)
 		{
-			CSteamID SteamGroupID = SteamFriends()->GetClanByIndex(i);
+			CSteamID SteamGroupID = USteamServiceSubsystem::GetSteamFriends()->GetClanByIndex(i);
 
 			if(!SteamGroupID.IsValid())
 				continue;
@@ -76,9 +78,9 @@ void UAdvancedSteamFriendsLibrary::GetSteamGroups(TArray<FBPSteamGroupInfo> & St
 
 			TSharedPtr<const FUniqueNetId> ValueID(new const FUniqueNetIdSteam2(SteamGroupID));
 			GroupInfo.GroupID.SetUniqueNetId(ValueID);
-			SteamFriends()->GetClanActivityCounts(SteamGroupID, &GroupInfo.numOnline, &GroupInfo.numInGame, &GroupInfo.numChatting);
-			GroupInfo.GroupName = FString(UTF8_TO_TCHAR(SteamFriends()->GetClanName(SteamGroupID)));
-			GroupInfo.GroupTag = FString(UTF8_TO_TCHAR(SteamFriends()->GetClanTag(SteamGroupID)));
+			USteamServiceSubsystem::GetSteamFriends()->GetClanActivityCounts(SteamGroupID, &GroupInfo.numOnline, &GroupInfo.numInGame, &GroupInfo.numChatting);
+			GroupInfo.GroupName = FString(UTF8_TO_TCHAR(USteamServiceSubsystem::GetSteamFriends()->GetClanName(SteamGroupID)));
+			GroupInfo.GroupTag = FString(UTF8_TO_TCHAR(USteamServiceSubsystem::GetSteamFriends()->GetClanTag(SteamGroupID)));
 
 			SteamGroups.Add(GroupInfo);
 		}
@@ -98,12 +100,12 @@ void UAdvancedSteamFriendsLibrary::GetSteamFriendGamePlayed(const FBPUniqueNetId
 		return;
 	}
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		uint64 id = *((uint64*)UniqueNetId.UniqueNetId->GetBytes());
 
 		FriendGameInfo_t GameInfo;
-		bool bIsInGame = SteamFriends()->GetFriendGamePlayed(id, &GameInfo);
+		bool bIsInGame = USteamServiceSubsystem::GetSteamFriends()->GetFriendGamePlayed(id, &GameInfo);
 
 		if (bIsInGame && GameInfo.m_gameID.IsValid())
 		{
@@ -139,11 +141,11 @@ int32 UAdvancedSteamFriendsLibrary::GetFriendSteamLevel(const FBPUniqueNetId Uni
 		return 0;
 	}
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		uint64 id = *((uint64*)UniqueNetId.UniqueNetId->GetBytes());
 
-		return SteamFriends()->GetFriendSteamLevel(id);
+		return USteamServiceSubsystem::GetSteamFriends()->GetFriendSteamLevel(id);
 	}
 #endif
 
@@ -160,10 +162,10 @@ FString UAdvancedSteamFriendsLibrary::GetSteamPersonaName(const FBPUniqueNetId U
 		return FString(TEXT(""));
 	}
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		uint64 id = *((uint64*)UniqueNetId.UniqueNetId->GetBytes());
-		const char* PersonaName = SteamFriends()->GetFriendPersonaName(id);
+		const char* PersonaName = USteamServiceSubsystem::GetSteamFriends()->GetFriendPersonaName(id);
 		return FString(UTF8_TO_TCHAR(PersonaName));
 	}
 #endif
@@ -182,7 +184,7 @@ FBPUniqueNetId UAdvancedSteamFriendsLibrary::CreateSteamIDFromString(const FStri
 		return netId;
 	}
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		// Already does the conversion
 		TSharedPtr<const FUniqueNetId> ValueID(new const FUniqueNetIdSteam2(SteamID64));
@@ -201,9 +203,9 @@ FBPUniqueNetId UAdvancedSteamFriendsLibrary::GetLocalSteamIDFromSteam()
 	FBPUniqueNetId netId;
 
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
-		TSharedPtr<const FUniqueNetId> SteamID(new const FUniqueNetIdSteam2(SteamUser()->GetSteamID()));
+		TSharedPtr<const FUniqueNetId> SteamID(new const FUniqueNetIdSteam2(USteamServiceSubsystem::GetSteamUser()->GetSteamID()));
 		netId.SetUniqueNetId(SteamID);
 	}
 #endif
@@ -220,11 +222,11 @@ bool UAdvancedSteamFriendsLibrary::RequestSteamFriendInfo(const FBPUniqueNetId U
 		return false;
 	}
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		uint64 id = *((uint64*)UniqueNetId.UniqueNetId->GetBytes());
 
-		return !SteamFriends()->RequestUserInformation(id, bRequireNameOnly);
+		return !USteamServiceSubsystem::GetSteamFriends()->RequestUserInformation(id, bRequireNameOnly);
 	}
 #endif
 
@@ -242,17 +244,17 @@ bool UAdvancedSteamFriendsLibrary::OpenSteamUserOverlay(const FBPUniqueNetId Uni
 		return false;
 	}
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		uint64 id = *((uint64*)UniqueNetId.UniqueNetId->GetBytes());
 		if (DialogType == ESteamUserOverlayType::invitetolobby)
 		{
-			SteamFriends()->ActivateGameOverlayInviteDialog(id);
+			USteamServiceSubsystem::GetSteamFriends()->ActivateGameOverlayInviteDialog(id);
 		}
 		else
 		{
 			FString DialogName = EnumToString("ESteamUserOverlayType", (uint8)DialogType);
-			SteamFriends()->ActivateGameOverlayToUser(TCHAR_TO_ANSI(*DialogName), id);
+			USteamServiceSubsystem::GetSteamFriends()->ActivateGameOverlayToUser(TCHAR_TO_ANSI(*DialogName), id);
 		}
 		return true;
 	}
@@ -265,9 +267,9 @@ bool UAdvancedSteamFriendsLibrary::OpenSteamUserOverlay(const FBPUniqueNetId Uni
 bool UAdvancedSteamFriendsLibrary::IsOverlayEnabled()
 {
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
-		return SteamUtils()->IsOverlayEnabled();
+		return USteamServiceSubsystem::GetSteamUtils()->IsOverlayEnabled();
 	}
 #endif
 
@@ -278,6 +280,9 @@ bool UAdvancedSteamFriendsLibrary::IsOverlayEnabled()
 UTexture2D * UAdvancedSteamFriendsLibrary::GetSteamFriendAvatar(const FBPUniqueNetId UniqueNetId, EBlueprintAsyncResultSwitch &Result, SteamAvatarSize AvatarSize)
 {
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
+	// Every call creates a new transient texture, tracked here so repeated calls show up as growth
+	LLM_SCOPE_BYTAG(SteamAvatars);
+
 	if (!UniqueNetId.IsValid() || !UniqueNetId.UniqueNetId->IsValid() || UniqueNetId.UniqueNetId->GetType() != STEAM_SUBSYSTEM)
 	{
 		UE_LOG(AdvancedSteamFriendsLog, Warning, TEXT("GetSteamFriendAvatar Had a bad UniqueNetId!"));
@@ -288,7 +293,7 @@ UTexture2D * UAdvancedSteamFriendsLibrary::GetSteamFriendAvatar(const FBPUniqueN
 	uint32 Width = 0;
 	uint32 Height = 0;
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		//Getting the PictureID from the SteamAPI and getting the Size with the ID
 		//virtual bool RequestUserInformation( CSteamID steamIDUser, bool bRequireNameOnly ) = 0;
@@ -299,9 +304,9 @@ UTexture2D * UAdvancedSteamFriendsLibrary::GetSteamFriendAvatar(const FBPUniqueN
 		
 		switch(AvatarSize)
 		{
-		case SteamAvatarSize::SteamAvatar_Small: Picture = SteamFriends()->GetSmallFriendAvatar(id); break;
-		case SteamAvatarSize::SteamAvatar_Medium: Picture = SteamFriends()->GetMediumFriendAvatar(id); break;
-		case SteamAvatarSize::SteamAvatar_Large: Picture = SteamFriends()->GetLargeFriendAvatar(id); break;
+		case SteamAvatarSize::SteamAvatar_Small: Picture = USteamServiceSubsystem::GetSteamFriends()->GetSmallFriendAvatar(id); break;
+		case SteamAvatarSize::SteamAvatar_Medium: Picture = USteamServiceSubsystem::GetSteamFriends()->GetMediumFriendAvatar(id); break;
+		case SteamAvatarSize::SteamAvatar_Large: Picture = USteamServiceSubsystem::GetSteamFriends()->GetLargeFriendAvatar(id); break;
 		default: break;
 		}
 
@@ -311,7 +316,7 @@ UTexture2D * UAdvancedSteamFriendsLibrary::GetSteamFriendAvatar(const FBPUniqueN
 			return NULL;
 		}
 
-		SteamUtils()->GetImageSize(Picture, &Width, &Height);
+		USteamServiceSubsystem::GetSteamUtils()->GetImageSize(Picture, &Width, &Height);
 
 		// STOLEN FROM ANSWERHUB :p, then fixed because answerhub wasn't releasing the memory O.o
 		// Also fixed image pixel format and switched to a memcpy instead of manual iteration.
@@ -324,7 +329,7 @@ UTexture2D * UAdvancedSteamFriendsLibrary::GetSteamFriendAvatar(const FBPUniqueN
 
 
 			//Filling the buffer with the RGBA Stream from the Steam Avatar and creating a UTextur2D to parse the RGBA Steam in
-			SteamUtils()->GetImageRGBA(Picture, (uint8*)oAvatarRGBA, 4 * Height * Width * sizeof(char));
+			USteamServiceSubsystem::GetSteamUtils()->GetImageRGBA(Picture, (uint8*)oAvatarRGBA, 4 * Height * Width * sizeof(char));
 
 
 			// Removed as I changed the image bit code to be RGB, I think the original author was unaware that there were different pixel formats
@@ -379,9 +384,9 @@ bool UAdvancedSteamFriendsLibrary::InitTextFiltering()
 {
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
-		return SteamUtils()->InitFilterText();
+		return USteamServiceSubsystem::GetSteamUtils()->InitFilterText();
 	}
 
 #endif
@@ -393,7 +398,7 @@ bool UAdvancedSteamFriendsLibrary::FilterText(FString TextToFilter, EBPTextFilte
 {
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		uint32 BufferLen = TextToFilter.Len() + 10; // Docs say 1 byte excess min, going with 10
 		char* OutText = new char[BufferLen];
@@ -405,7 +410,7 @@ bool UAdvancedSteamFriendsLibrary::FilterText(FString TextToFilter, EBPTextFilte
 			id = *((uint64*)TextSourceID.UniqueNetId->GetBytes());
 		}
 		
-		int FilterCount = SteamUtils()->FilterText((ETextFilteringContext)Context, id, TCHAR_TO_ANSI(*TextToFilter), OutText, BufferLen);
+		int FilterCount = USteamServiceSubsystem::GetSteamUtils()->FilterText((ETextFilteringContext)Context, id, TCHAR_TO_ANSI(*TextToFilter), OutText, BufferLen);
 
 		if (FilterCount > 0)
 		{
@@ -427,9 +432,9 @@ bool UAdvancedSteamFriendsLibrary::IsSteamInBigPictureMode()
 {
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
-		return SteamUtils()->IsSteamInBigPictureMode();
+		return USteamServiceSubsystem::GetSteamUtils()->IsSteamInBigPictureMode();
 	}
 
 #endif
@@ -1,6 +1,7 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 #include "AdvancedSteamWorkshopLibrary.h"
 #include "OnlineSubSystemHeader.h"
+#include "SteamServiceSubsystem.h"
 //General Log
 DEFINE_LOG_CATEGORY(AdvancedSteamWorkshopLog);
 
@@ -10,9 +11,9 @@ void UAdvancedSteamWorkshopLibrary::GetNumSubscribedWorkshopItems(int32 & Number
 	NumberOfItems = 0;
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
-		NumberOfItems = SteamUGC()->GetNumSubscribedItems();
+		NumberOfItems = USteamServiceSubsystem::GetSteamUGC()->GetNumSubscribedItems();
 		return;
 	}
 	else
@@ -33,9 +34,9 @@ TArray<FBPSteamWorkshopID> UAdvancedSteamWorkshopLibrary::GetSubscribedWorkshopI
 
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
-		uint32 NumItems = SteamUGC()->GetNumSubscribedItems();
+		uint32 NumItems = USteamServiceSubsystem::GetSteamUGC()->GetNumSubscribedItems();
 		
 		if (NumItems == 0)
 			return outArray;
@@ -46,7 +47,7 @@ TArray<FBPSteamWorkshopID> UAdvancedSteamWorkshopLibrary::GetSubscribedWorkshopI
 
 		PublishedFileId_t *fileIds = new PublishedFileId_t[NumItems];
 		
-		uint32 subItems = SteamUGC()->GetSubscribedItems(fileIds, NumItems);
+		uint32 subItems = USteamServiceSubsystem::GetSteamUGC()->GetSubscribedItems(fileIds, NumItems);
 
 		for (uint32 i = 0; i < subItems; ++i)
 		{
@@ -4,6 +4,7 @@
 #include "Online/CoreOnline.h"
 #include "AdvancedSteamFriendsLibrary.h"
 #include "OnlineSubSystemHeader.h"
+#include "SteamServiceSubsystem.h"
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 #include "steam/isteamfriends.h"
 #endif
@@ -32,10 +33,10 @@ USteamRequestGroupOfficersCallbackProxy* USteamRequestGroupOfficersCallbackProxy
 void USteamRequestGroupOfficersCallbackProxy::Activate()
 {
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		uint64 id = *((uint64*)GroupUniqueID.UniqueNetId->GetBytes());
-		SteamAPICall_t hSteamAPICall = SteamFriends()->RequestClanOfficerList(id);
+		SteamAPICall_t hSteamAPICall = USteamServiceSubsystem::GetSteamFriends()->RequestClanOfficerList(id);
 	
 		m_callResultGroupOfficerRequestDetails.Set(hSteamAPICall, this, &USteamRequestGroupOfficersCallbackProxy::OnRequestGroupOfficerDetails);
 		return;
@@ -48,30 +49,16 @@ void USteamRequestGroupOfficersCallbackProxy::Activate()
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 void USteamRequestGroupOfficersCallbackProxy::OnRequestGroupOfficerDetails(ClanOfficerListResponse_t *pResult, bool bIOFailure)
 {
+	// Read the officers where steam delivered them, but only broadcast to blueprints from the game thread
+	bool bSucceeded = false;
 	TArray<FBPSteamGroupOfficer> OfficerArray;
-	
-	//FOnlineSubsystemSteam* SteamSubsystem = (FOnlineSubsystemSteam*)(IOnlineSubsystem::Get(STEAM_SUBSYSTEM));
-
-	if (bIOFailure || !pResult || !pResult->m_bSuccess)
-	{
-		//if (SteamSubsystem != nullptr)
-		{
-		//	SteamSubsystem->ExecuteNextTick([this]()
-			//{
-				TArray<FBPSteamGroupOfficer> FailureArray;
-				OnFailure.Broadcast(FailureArray);
-			//});
-		}
-		//OnFailure.Broadcast(OfficerArray);
-		return;
-	}
 
-	if (SteamAPI_Init())
+	if (!bIOFailure && pResult && pResult->m_bSuccess && USteamServiceSubsystem::IsSteamReady())
 	{
 		uint64 id = *((uint64*)GroupUniqueID.UniqueNetId->GetBytes());
 
 		FBPSteamGroupOfficer Officer;
-		CSteamID ClanOwner = SteamFriends()->GetClanOwner(id);
+		CSteamID ClanOwner = USteamServiceSubsystem::GetSteamFriends()->GetClanOwner(id);
 
 		Officer.bIsOwner = true;
 
@@ -81,7 +68,7 @@ void USteamRequestGroupOfficersCallbackProxy::OnRequestGroupOfficerDetails(ClanO
 
 		for (int i = 0; i < pResult->m_cOfficers; i++)
 		{
-			CSteamID OfficerSteamID = SteamFriends()->GetClanOfficerByIndex(id, i);
+			CSteamID OfficerSteamID = USteamServiceSubsystem::GetSteamFriends()->GetClanOfficerByIndex(id, i);
 
 			Officer.bIsOwner = false;
 
@@ -91,31 +78,26 @@ void USteamRequestGroupOfficersCallbackProxy::OnRequestGroupOfficerDetails(ClanO
 			OfficerArray.Add(Officer);
 		}
 
-		//if (SteamSubsystem != nullptr)
-		//{
-			//SteamSubsystem->ExecuteNextTick([OfficerArray, this]()
-			//{
-				OnSuccess.Broadcast(OfficerArray);
-			//});
-		//}
-
-		//OnSuccess.Broadcast(OfficerArray);
-		return;
+		bSucceeded = true;
 	}
-	else
+
+	TWeakObjectPtr<USteamRequestGroupOfficersCallbackProxy> WeakThis(this);
+	USteamServiceSubsystem::RunOnGameThread([WeakThis, bSucceeded, OfficerArray = MoveTemp(OfficerArray)]()
 	{
-		//if (SteamSubsystem != nullptr)
+		if (!WeakThis.IsValid())
 		{
-			//SteamSubsystem->ExecuteNextTick([this]()
-			//{
-				TArray<FBPSteamGroupOfficer> FailureArray;
-				OnFailure.Broadcast(FailureArray);
-			//});
+			return;
 		}
-	}
 
-	// Should never hit this anyway
-	//OnFailure.Broadcast(OfficerArray);
+		if (bSucceeded)
+		{
+			WeakThis->OnSuccess.Broadcast(OfficerArray);
+		}
+		else
+		{
+			WeakThis->OnFailure.Broadcast(TArray<FBPSteamGroupOfficer>());
+		}
+	});
 }
 #endif
 
@@ -0,0 +1,211 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#include "SteamServiceSubsystem.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/ScopeLock.h"
+#include "OnlineSubsystem.h"
+#include "OnlineSubsystemNames.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+#include <atomic>
+
+#if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
+
+#include <steam/steam_api.h>
+
+#endif
+
+DEFINE_LOG_CATEGORY(SteamServiceLog);
+
+DECLARE_STATS_GROUP(TEXT("AdvancedSteam"), STATGROUP_AdvancedSteam, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Steam Callback Pump"), STAT_SteamCallbackPump, STATGROUP_AdvancedSteam);
+
+static TAutoConsoleVariable<float> CVarSteamCallbackHz(
+	TEXT("AdvancedSteam.CallbackHz"),
+	30.0f,
+	TEXT("How many times a second Steam callbacks are pumped on the game thread when OnlineSubsystemSteam isn't pumping them. 0 pumps every frame."),
+	ECVF_Default);
+
+namespace SteamService
+{
+	// Held for the whole of each initialization attempt, other callers block on it until it is done
+	static FCriticalSection InitLock;
+
+	// A failed init is retried no more often than this, SteamAPI_Init is too slow to call every frame
+	static constexpr double InitRetrySeconds = 5.0;
+
+	static std::atomic<bool> bSteamReady{ false };
+
+	// Zero until the first attempt, written under InitLock
+	static std::atomic<double> NextInitAttemptSeconds{ 0.0 };
+
+	// Written once under InitLock before bSteamReady is published
+	static ISteamFriends* Friends = nullptr;
+	static ISteamUGC* UGC = nullptr;
+	static ISteamUser* User = nullptr;
+	static ISteamUtils* Utils = nullptr;
+}
+
+USteamServiceSubsystem* USteamServiceSubsystem::PumpOwner = nullptr;
+
+void USteamServiceSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+	Super::Initialize(Collection);
+
+	if (PumpOwner == nullptr)
+	{
+		PumpOwner = this;
+		PumpHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USteamServiceSubsystem::PumpCallbacks));
+	}
+}
+
+void USteamServiceSubsystem::Deinitialize()
+{
+	if (PumpOwner == this)
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(PumpHandle);
+		PumpHandle.Reset();
+		PumpOwner = nullptr;
+	}
+
+	// Steam itself stays up, the online subsystem shuts it down with the engine
+	Super::Deinitialize();
+}
+
+bool USteamServiceSubsystem::InitializeSteam(uint32 RestartAppId)
+{
+	if (SteamService::bSteamReady.load(std::memory_order_acquire))
+	{
+		return true;
+	}
+
+	// Failed recently, don't try again yet
+	if (FPlatformTime::Seconds() < SteamService::NextInitAttemptSeconds.load(std::memory_order_acquire))
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&SteamService::InitLock);
+
+	// Someone else finished (or failed) while we were waiting on the lock
+	if (SteamService::bSteamReady.load(std::memory_order_acquire))
+	{
+		return true;
+	}
+	if (FPlatformTime::Seconds() < SteamService::NextInitAttemptSeconds.load(std::memory_order_relaxed))
+	{
+		return false;
+	}
+
+#if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
+	const bool bFirstAttempt = SteamService::NextInitAttemptSeconds.load(std::memory_order_relaxed) == 0.0;
+
+	// Relaunching only makes sense once, at startup
+	if (RestartAppId != 0 && bFirstAttempt)
+	{
+		SteamAPI_RestartAppIfNecessary(RestartAppId);
+	}
+
+	if (SteamAPI_Init())
+	{
+		SteamService::Friends = SteamFriends();
+		SteamService::UGC = SteamUGC();
+		SteamService::User = SteamUser();
+		SteamService::Utils = SteamUtils();
+		SteamService::bSteamReady.store(true, std::memory_order_release);
+	}
+	else if (bFirstAttempt)
+	{
+		UE_LOG(SteamServiceLog, Warning, TEXT("SteamAPI_Init failed, Steam functions will report failure until a retry succeeds"));
+	}
+#endif
+
+	SteamService::NextInitAttemptSeconds.store(FPlatformTime::Seconds() + SteamService::InitRetrySeconds, std::memory_order_release);
+	return SteamService::bSteamReady.load(std::memory_order_acquire);
+}
+
+bool USteamServiceSubsystem::IsSteamReady()
+{
+	if (SteamService::bSteamReady.load(std::memory_order_acquire))
+	{
+		return true;
+	}
+
+	return InitializeSteam();
+}
+
+ISteamFriends* USteamServiceSubsystem::GetSteamFriends()
+{
+	return SteamService::Friends;
+}
+
+ISteamUGC* USteamServiceSubsystem::GetSteamUGC()
+{
+	return SteamService::UGC;
+}
+
+ISteamUser* USteamServiceSubsystem::GetSteamUser()
+{
+	return SteamService::User;
+}
+
+ISteamUtils* USteamServiceSubsystem::GetSteamUtils()
+{
+	return SteamService::Utils;
+}
+
+void USteamServiceSubsystem::RunOnGameThread(TUniqueFunction<void()> Work)
+{
+	if (IsInGameThread())
+	{
+		Work();
+		return;
+	}
+
+	AsyncTask(ENamedThreads::GameThread, MoveTemp(Work));
+}
+
+bool USteamServiceSubsystem::IsOnlineSubsystemPumping()
+{
+	// The steam online subsystem only exists once it initialized, and from then on its online thread runs the callbacks
+	return IOnlineSubsystem::DoesInstanceExist(STEAM_SUBSYSTEM);
+}
+
+bool USteamServiceSubsystem::PumpCallbacks(float DeltaTime)
+{
+	// Never initializes Steam itself, that stays with whoever needs it first
+	if (!SteamService::bSteamReady.load(std::memory_order_acquire))
+	{
+		return true;
+	}
+
+	// A second pump would run each callback on whichever thread got to it first
+	if (IsOnlineSubsystemPumping())
+	{
+		TimeSincePump = 0.0f;
+		return true;
+	}
+
+	TimeSincePump += DeltaTime;
+
+	const float CallbackHz = CVarSteamCallbackHz.GetValueOnGameThread();
+	const float PumpInterval = CallbackHz > 0.0f ? 1.0f / CallbackHz : 0.0f;
+	if (TimeSincePump < PumpInterval)
+	{
+		return true;
+	}
+
+	// Carry the remainder so the rate holds when it does not divide the frame time evenly
+	TimeSincePump = PumpInterval > 0.0f ? FMath::Fmod(TimeSincePump, PumpInterval) : 0.0f;
+
+#if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
+	SCOPE_CYCLE_COUNTER(STAT_SteamCallbackPump);
+	TRACE_CPUPROFILER_EVENT_SCOPE(SteamCallbackPump);
+
+	// Delivers everything queued since the last pump, in one batch
+	SteamAPI_RunCallbacks();
+#endif
+
+	return true;
+}
@@ -2,6 +2,7 @@
 
 #include "SteamWSRequestUGCDetailsCallbackProxy.h"
 #include "OnlineSubSystemHeader.h"
+#include "SteamServiceSubsystem.h"
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 #include "steam/isteamugc.h"
 #endif
@@ -26,15 +27,15 @@ USteamWSRequestUGCDetailsCallbackProxy* USteamWSRequestUGCDetailsCallbackProxy::
 void USteamWSRequestUGCDetailsCallbackProxy::Activate()
 {
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
-	if (SteamAPI_Init())
+	if (USteamServiceSubsystem::IsSteamReady())
 	{
 		// #TODO: Support arrays instead in the future?
-		UGCQueryHandle_t hQueryHandle = SteamUGC()->CreateQueryUGCDetailsRequest((PublishedFileId_t *)&WorkShopID.SteamWorkshopID, 1);
+		UGCQueryHandle_t hQueryHandle = USteamServiceSubsystem::GetSteamUGC()->CreateQueryUGCDetailsRequest((PublishedFileId_t *)&WorkShopID.SteamWorkshopID, 1);
 		// #TODO: add search settings here by calling into the handle?
-		SteamAPICall_t hSteamAPICall = SteamUGC()->SendQueryUGCRequest(hQueryHandle);
+		SteamAPICall_t hSteamAPICall = USteamServiceSubsystem::GetSteamUGC()->SendQueryUGCRequest(hQueryHandle);
 
 		// Need to release the query
-		SteamUGC()->ReleaseQueryUGCRequest(hQueryHandle);
+		USteamServiceSubsystem::GetSteamUGC()->ReleaseQueryUGCRequest(hQueryHandle);
 
 		if (hSteamAPICall == k_uAPICallInvalid)
 		{
@@ -51,51 +52,33 @@ void USteamWSRequestUGCDetailsCallbackProxy::Activate()
 
 #if STEAM_SDK_INSTALLED && (PLATFORM_WINDOWS || PLATFORM_MAC || PLATFORM_LINUX)
 void USteamWSRequestUGCDetailsCallbackProxy::OnUGCRequestUGCDetails(SteamUGCQueryCompleted_t *pResult, bool bIOFailure)
-{	
-	//FOnlineSubsystemSteam* SteamSubsystem = (FOnlineSubsystemSteam*)(IOnlineSubsystem::Get(STEAM_SUBSYSTEM));
+{
+	// Read the result where steam delivered it, but only broadcast to blueprints from the game thread
+	bool bSucceeded = false;
+	SteamUGCDetails_t Details;
 
-	if (bIOFailure || !pResult || pResult->m_unNumResultsReturned <= 0)
+	if (!bIOFailure && pResult && pResult->m_unNumResultsReturned > 0 && USteamServiceSubsystem::IsSteamReady())
 	{
-		//if (SteamSubsystem != nullptr)
-		{
-		//	SteamSubsystem->ExecuteNextTick([this]()
-			//{
-				OnFailure.Broadcast(FBPSteamWorkshopItemDetails());
-			//});
-		}
-		//OnFailure.Broadcast(FBPSteamWorkshopItemDetails());
-		return;
+		bSucceeded = USteamServiceSubsystem::GetSteamUGC()->GetQueryUGCResult(pResult->m_handle, 0, &Details);
 	}
-	if (SteamAPI_Init())
+
+	TWeakObjectPtr<USteamWSRequestUGCDetailsCallbackProxy> WeakThis(this);
+	USteamServiceSubsystem::RunOnGameThread([WeakThis, bSucceeded, Details]()
 	{
-		SteamUGCDetails_t Details;
-		if (SteamUGC()->GetQueryUGCResult(pResult->m_handle, 0, &Details))
+		if (!WeakThis.IsValid())
 		{
-			//if (SteamSubsystem != nullptr)
-			{
-				//SteamSubsystem->ExecuteNextTick([Details, this]()
-				//{
-					OnSuccess.Broadcast(FBPSteamWorkshopItemDetails(Details));
-				//});
-			}
-
-			//OnSuccess.Broadcast(FBPSteamWorkshopItemDetails(Details));
 			return;
 		}
-	}
-	else
-	{
-		//if (SteamSubsystem != nullptr)
+
+		if (bSucceeded)
 		{
-			//SteamSubsystem->ExecuteNextTick([this]()
-			//{
-				OnFailure.Broadcast(FBPSteamWorkshopItemDetails());
-			//});
+			WeakThis->OnSuccess.Broadcast(FBPSteamWorkshopItemDetails(Details));
 		}
-	}
-
-	// Not needed, should never hit here
-	//OnFailure.Broadcast(FBPSteamWorkshopItemDetails());
+		else
+		{
+			WeakThis->OnFailure.Broadcast(FBPSteamWorkshopItemDetails());
+		}
+	});
 }
 #endif
 
@@ -0,0 +1,235 @@
+
+#include "SandboxBotController.h"
+#include "AllLevels/Character/FirstPersonCharacter.h"
+#include "AllLevels/Utility/SandboxStats.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "FirstPersonLevel/KinematicAnimationSubsystem.h"
+
+/*
+ *  SandboxBotController.cpp                          Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxBotController plays a FirstPersonCharacter without a
+ *  human. It presses the same input handlers a player's devices
+ *  would (sticks, face buttons, bumpers, d-pad), so every system
+ *  hanging off input gets exercised when the game is load tested.
+ *
+ *  Behaviors
+ *    - Wander: Walks in randomly changing directions, now and then
+ *      jumping.
+ *    - Fly: Takes off and drifts around, thrusting up and down.
+ *    - Grab: Looks slightly down while walking and keeps grabbing,
+ *      throwing and releasing whatever is in front of it.
+ *    - RidePlatform: Walks to a random carousel or elevator and
+ *      jumps on.
+ *
+ *  Note: Pawns only forward look input to player controllers, so
+ *        the bot turns its own control rotation by the same stick
+ *        input it sends to OnStickRight().
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+ASandboxBotController::ASandboxBotController() {
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickGroup = TG_PrePhysics;
+	bWantsPlayerState = false;
+}
+
+void ASandboxBotController::Tick(float DeltaSeconds) {
+	Super::Tick(DeltaSeconds);
+	SANDBOX_SCOPE(Bots);
+	if (!BotCharacter) return;
+
+	// Finish Last Frame's Button Taps
+	if (IsJumpHeld) {
+		GetInputCharacter()->OnFaceBottomRelease();
+		IsJumpHeld = false;
+	}
+
+	// Pick Next Behavior
+	BehaviorTimeRemaining -= DeltaSeconds;
+	if (BehaviorTimeRemaining <= 0.0f) {
+		StartBehavior(RandomizeBehavior ? (ESandboxBotBehavior) RandomStream.RandRange(0, 3) : ScriptedBehavior);
+	}
+
+	switch (Behavior) {
+		case ESandboxBotBehavior::Wander: UpdateWander(DeltaSeconds); break;
+		case ESandboxBotBehavior::Fly: UpdateFly(DeltaSeconds); break;
+		case ESandboxBotBehavior::Grab: UpdateGrab(DeltaSeconds); break;
+		case ESandboxBotBehavior::RidePlatform: UpdateRidePlatform(DeltaSeconds); break;
+	}
+
+	SendInput(DeltaSeconds);
+}
+
+void ASandboxBotController::OnPossess(APawn* InPawn) {
+	Super::OnPossess(InPawn);
+
+	BotCharacter = Cast<AFirstPersonCharacter>(InPawn);
+	SetControlRotation(InPawn->GetActorRotation());
+	StartBehavior(ScriptedBehavior);
+}
+
+void ASandboxBotController::OnUnPossess() {
+	BotCharacter = nullptr;
+
+	Super::OnUnPossess();
+}
+
+
+/*--- Bot Functions ---*/
+
+void ASandboxBotController::SetBotSeed(int32 Seed) {
+	RandomStream.Initialize(Seed);
+}
+
+void ASandboxBotController::SetScriptedBehavior(ESandboxBotBehavior NewBehavior) {
+	ScriptedBehavior = NewBehavior;
+	if (BotCharacter) StartBehavior(NewBehavior);
+}
+
+void ASandboxBotController::StartBehavior(ESandboxBotBehavior NewBehavior) {
+	Behavior = NewBehavior;
+	BehaviorTimeRemaining = RandomStream.FRandRange(MIN_BEHAVIOR_TIME, MAX_BEHAVIOR_TIME);
+	ActionTimeRemaining = 0.0f;
+	MoveInput = FVector2D::ZeroVector;
+	LookInput = FVector2D::ZeroVector;
+	TargetPlatform = nullptr;
+
+	SetFlying(Behavior == ESandboxBotBehavior::Fly);
+	if (BotCharacter && IsThrustingUp) {
+		GetInputCharacter()->OnBumperRightRelease();
+		IsThrustingUp = false;
+	}
+
+	// Choose a Platform to Ride
+	if (Behavior == ESandboxBotBehavior::RidePlatform) {
+		TArray<UPrimitiveComponent*> Platforms;
+		UKinematicAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UKinematicAnimationSubsystem>();
+		if (AnimationSubsystem) AnimationSubsystem->GetAnimatedPrimitives(Platforms);
+
+		if (Platforms.Num() > 0) {
+			TargetPlatform = Platforms[RandomStream.RandRange(0, Platforms.Num() - 1)];
+		} else {
+			Behavior = ESandboxBotBehavior::Wander;
+		}
+	}
+}
+
+void ASandboxBotController::UpdateWander(float DeltaSeconds) {
+	ActionTimeRemaining -= DeltaSeconds;
+	if (ActionTimeRemaining > 0.0f) return;
+
+	// New Heading, Occasional Jump
+	ActionTimeRemaining = RandomStream.FRandRange(MIN_WANDER_TURN_TIME, MAX_WANDER_TURN_TIME);
+	MoveInput = FVector2D(RandomStream.FRandRange(-0.5f, 0.5f), RandomStream.FRandRange(0.3f, 1.0f));
+	LookInput = FVector2D(RandomStream.FRandRange(-0.6f, 0.6f), 0.0f);
+	if (RandomStream.FRand() < 0.25f) PressJump();
+}
+
+void ASandboxBotController::UpdateFly(float DeltaSeconds) {
+	ActionTimeRemaining -= DeltaSeconds;
+	if (ActionTimeRemaining > 0.0f) return;
+
+	// Drift and Alternate Thrust
+	ActionTimeRemaining = FLIGHT_THRUST_INTERVAL;
+	MoveInput = FVector2D(RandomStream.FRandRange(-0.5f, 0.5f), RandomStream.FRandRange(0.0f, 1.0f));
+	LookInput = FVector2D(RandomStream.FRandRange(-0.4f, 0.4f), 0.0f);
+
+	if (IsThrustingUp) {
+		GetInputCharacter()->OnBumperRightRelease();
+	} else {
+		GetInputCharacter()->OnBumperRightPress();
+	}
+	IsThrustingUp = !IsThrustingUp;
+}
+
+void ASandboxBotController::UpdateGrab(float DeltaSeconds) {
+
+	// Keep the View Angled Toward the Floor
+	const float PitchError = GRAB_LOOK_PITCH - FRotator::NormalizeAxis(GetControlRotation().Pitch);
+	LookInput.Y = FMath::Clamp(PitchError / FULL_LOOK_ANGLE, -1.0f, 1.0f);
+
+	ActionTimeRemaining -= DeltaSeconds;
+	if (ActionTimeRemaining > 0.0f) return;
+
+	// Grab, Throw or Release Whatever Is in View
+	ActionTimeRemaining = GRAB_INTERVAL;
+	MoveInput = FVector2D(0.0f, RandomStream.FRandRange(0.0f, 0.6f));
+	LookInput.X = RandomStream.FRandRange(-0.5f, 0.5f);
+	PressGrab();
+}
+
+void ASandboxBotController::UpdateRidePlatform(float DeltaSeconds) {
+	UPrimitiveComponent* Platform = TargetPlatform.Get();
+	if (!Platform) {
+		StartBehavior(ESandboxBotBehavior::Wander);
+		return;
+	}
+
+	// Stand Still Once Aboard
+	if (BotCharacter->GetMovementBase() == Platform) {
+		MoveInput = FVector2D::ZeroVector;
+		LookInput = FVector2D::ZeroVector;
+		return;
+	}
+
+	SteerToward(Platform->Bounds.Origin);
+
+	// Hop On When Close
+	const float Distance = FVector::Dist2D(BotCharacter->GetActorLocation(), Platform->Bounds.Origin);
+	if (Distance < ARRIVAL_DISTANCE + Platform->Bounds.SphereRadius && !BotCharacter->GetCharacterMovement()->IsFalling()) {
+		PressJump();
+	}
+}
+
+void ASandboxBotController::SteerToward(const FVector& Location) {
+	const FVector ToTarget = (Location - BotCharacter->GetActorLocation()).GetSafeNormal2D();
+	const float YawError = FRotator::NormalizeAxis(ToTarget.Rotation().Yaw - GetControlRotation().Yaw);
+
+	LookInput = FVector2D(FMath::Clamp(YawError / FULL_LOOK_ANGLE, -1.0f, 1.0f), 0.0f);
+	MoveInput = FVector2D(0.0f, FMath::Abs(YawError) < 90.0f ? 1.0f : 0.0f);
+}
+
+void ASandboxBotController::SetFlying(bool ShouldFly) {
+	if (!BotCharacter || WantsToFly == ShouldFly) return;
+
+	// D-Pad Up Toggles Flight
+	GetInputCharacter()->OnDPadUpPress();
+	GetInputCharacter()->OnDPadUpRelease();
+	WantsToFly = ShouldFly;
+}
+
+
+/*--- Input Functions ---*/
+
+void ASandboxBotController::SendInput(float DeltaSeconds) {
+	GetInputCharacter()->OnStickLeft(MoveInput);
+	GetInputCharacter()->OnStickRight(LookInput);
+
+	// Apply Look Ourselves (See Note Above)
+	FRotator Rotation = GetControlRotation();
+	Rotation.Yaw += LookInput.X * LOOK_RATE * DeltaSeconds;
+	Rotation.Pitch = FMath::ClampAngle(Rotation.Pitch + LookInput.Y * LOOK_RATE * DeltaSeconds, -89.0f, 89.0f);
+	SetControlRotation(Rotation);
+}
+
+AInputCharacter* ASandboxBotController::GetInputCharacter() const {
+	return BotCharacter;
+}
+
+void ASandboxBotController::PressJump() {
+	if (IsJumpHeld) return;
+
+	GetInputCharacter()->OnFaceBottomPress();
+	IsJumpHeld = true;
+}
+
+void ASandboxBotController::PressGrab() {
+	GetInputCharacter()->OnFaceRightPress();
+	GetInputCharacter()->OnFaceRightRelease();
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Controller.h"
+#include "SandboxBotController.generated.h"
+
+class AFirstPersonCharacter;
+class AInputCharacter;
+
+/*
+ *  SandboxBotController.h                            Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxBotController.cpp.
+ */
+
+UENUM(BlueprintType)
+enum class ESandboxBotBehavior : uint8 {
+	Wander          UMETA(DisplayName = "Wander"),
+	Fly             UMETA(DisplayName = "Fly"),
+	Grab            UMETA(DisplayName = "Grab"),
+	RidePlatform    UMETA(DisplayName = "Ride Platform")
+};
+
+UCLASS()
+class SANDBOX_API ASandboxBotController : public AController {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	private: const float MIN_BEHAVIOR_TIME = 4.0f;
+	private: const float MAX_BEHAVIOR_TIME = 10.0f;
+	private: const float MIN_WANDER_TURN_TIME = 0.5f;
+	private: const float MAX_WANDER_TURN_TIME = 2.0f;
+	private: const float GRAB_INTERVAL = 2.5f;
+	private: const float FLIGHT_THRUST_INTERVAL = 1.5f;
+	private: const float ARRIVAL_DISTANCE = 150.0f;
+	private: const float LOOK_RATE = 120.0f;
+	private: const float FULL_LOOK_ANGLE = 45.0f;
+	private: const float GRAB_LOOK_PITCH = -25.0f;
+
+
+	/*--- Variables ---*/
+
+	// Random Bots Pick a New Behavior Every Few Seconds, Scripted Bots Stick to One
+	public: UPROPERTY(EditAnywhere, Category=Bot)
+	bool RandomizeBehavior = true;
+
+	public: UPROPERTY(EditAnywhere, Category=Bot)
+	ESandboxBotBehavior ScriptedBehavior = ESandboxBotBehavior::Wander;
+
+	private: UPROPERTY()
+	AFirstPersonCharacter* BotCharacter = nullptr;
+
+	private: FRandomStream RandomStream;
+	private: ESandboxBotBehavior Behavior = ESandboxBotBehavior::Wander;
+	private: float BehaviorTimeRemaining = 0.0f;
+	private: float ActionTimeRemaining = 0.0f;
+	private: FVector2D MoveInput = FVector2D::ZeroVector;
+	private: FVector2D LookInput = FVector2D::ZeroVector;
+	private: TWeakObjectPtr<UPrimitiveComponent> TargetPlatform;
+	private: bool WantsToFly = false;
+	private: bool IsJumpHeld = false;
+	private: bool IsThrustingUp = false;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: ASandboxBotController();
+
+	public: virtual void Tick(float DeltaSeconds) override;
+
+	protected: virtual void OnPossess(APawn* InPawn) override;
+
+	protected: virtual void OnUnPossess() override;
+
+
+	/*--- Bot Functions ---*/
+
+	/** Seeds the bot's random stream, so a run with the same seeds replays the same choices. **/
+	public: void SetBotSeed(int32 Seed);
+
+	public: void SetScriptedBehavior(ESandboxBotBehavior NewBehavior);
+
+	private: void StartBehavior(ESandboxBotBehavior NewBehavior);
+
+	private: void UpdateWander(float DeltaSeconds);
+
+	private: void UpdateFly(float DeltaSeconds);
+
+	private: void UpdateGrab(float DeltaSeconds);
+
+	private: void UpdateRidePlatform(float DeltaSeconds);
+
+	private: void SteerToward(const FVector& Location);
+
+	private: void SetFlying(bool ShouldFly);
+
+
+	/*--- Input Functions ---*/
+
+	private: void SendInput(float DeltaSeconds);
+
+	// Handlers Are Protected, Reachable Through the Friended Base Class Only
+	private: AInputCharacter* GetInputCharacter() const;
+
+	private: void PressJump();
+
+	private: void PressGrab();
+
+};
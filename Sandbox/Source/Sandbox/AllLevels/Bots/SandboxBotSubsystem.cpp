@@ -0,0 +1,304 @@
+
+#include "SandboxBotSubsystem.h"
+#include "AllLevels/Character/FirstPersonCharacter.h"
+#include "AllLevels/Utility/SandboxStats.h"
+#include "CoreGlobals.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "SandboxBotController.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSandboxBots, Log, All);
+
+/*
+ *  SandboxBotSubsystem.cpp                           Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxBotSubsystem spawns bot players and measures how the
+ *  server holds up as their number grows. Launch a dedicated server
+ *  (or -nullrhi game) with:
+ *
+ *    -SandboxBots=N          Final bot count (Required)
+ *    -SandboxBotStep=S       Bots added per step (Default: N)
+ *    -SandboxBotStepTime=T   Seconds measured per step (Default: 30)
+ *    -SandboxBotWarmup=W     Seconds ignored after each spawn (Default: 5)
+ *    -SandboxBotSeed=X       Base seed for bot behavior (Default: 0)
+ *    -SandboxBotReport=Path  CSV output (Default: Saved/Profiling/SandboxBots)
+ *    -SandboxBotExit         Quit once the report is written
+ *
+ *    Each step records frame time, game thread time (excluding idle),
+ *  the physics window and process memory, one CSV row per bot count.
+ *
+ *  Note: The physics window runs from the start of TG_StartPhysics to
+ *        the start of TG_PostPhysics, so it includes any game work
+ *        overlapping the simulation in TG_DuringPhysics.
+ */
+
+
+/*--- Physics Marker Tick Function ---*/
+
+void FSandboxPhysicsMarkerTickFunction::ExecuteTick(
+	float DeltaTime,
+	ELevelTick TickType,
+	ENamedThreads::Type CurrentThread,
+	const FGraphEventRef& MyCompletionGraphEvent
+) {
+	Timestamp = FPlatformTime::Seconds();
+}
+
+FString FSandboxPhysicsMarkerTickFunction::DiagnosticMessage() {
+	return TEXT("FSandboxPhysicsMarkerTickFunction");
+}
+
+
+/*--- Lifecycle Functions ---*/
+
+void USandboxBotSubsystem::OnWorldBeginPlay(UWorld& InWorld) {
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Bots Live Wherever the Game Mode Does
+	if (InWorld.GetNetMode() == NM_Client || !ReadLoadTestSettings()) return;
+
+	UE_LOG(LogSandboxBots, Log, TEXT("Load test: %d bots, %d per step, %.0fs per step"), TargetBotCount, BotsPerStep, StepTime);
+	IsLoadTestRunning = true;
+	StartStep();
+}
+
+void USandboxBotSubsystem::Deinitialize() {
+	if (PhysicsStartMarker.IsTickFunctionRegistered()) PhysicsStartMarker.UnRegisterTickFunction();
+	if (PhysicsEndMarker.IsTickFunctionRegistered()) PhysicsEndMarker.UnRegisterTickFunction();
+
+	IsLoadTestRunning = false;
+	IsSampling = false;
+	Bots.Empty();
+
+	Super::Deinitialize();
+}
+
+void USandboxBotSubsystem::Tick(float DeltaTime) {
+	SANDBOX_SCOPE(Bots);
+	INC_DWORD_STAT_BY(STAT_SandboxBotCount, GetBotCount());
+
+	if (IsSampling) SampleFrame(DeltaTime);
+	if (!IsLoadTestRunning) return;
+
+	// Measure Once the New Bots Have Settled
+	StepElapsedTime += DeltaTime;
+	if (!IsSampling && StepElapsedTime > WarmupTime) StartSampling();
+
+	if (StepElapsedTime >= WarmupTime + StepTime) {
+		CompletedSteps.Add(FinishSampling());
+		if (GetBotCount() >= TargetBotCount) {
+			FinishLoadTest();
+		} else {
+			StartStep();
+		}
+	}
+}
+
+TStatId USandboxBotSubsystem::GetStatId() const {
+	RETURN_QUICK_DECLARE_CYCLE_STAT(USandboxBotSubsystem, STATGROUP_Tickables);
+}
+
+bool USandboxBotSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const {
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+/*--- Bot Functions ---*/
+
+void USandboxBotSubsystem::SpawnBots(int32 Count) {
+	UWorld* World = GetWorld();
+	AGameModeBase* GameMode = World->GetAuthGameMode();
+	if (!GameMode) return;
+
+	// Bots Drive First Person Pawns Only
+	TSubclassOf<APawn> PawnClass = GameMode->DefaultPawnClass;
+	if (!PawnClass || !PawnClass->IsChildOf(AFirstPersonCharacter::StaticClass())) {
+		PawnClass = AFirstPersonCharacter::StaticClass();
+	}
+
+	AActor* PlayerStart = GameMode->FindPlayerStart(nullptr);
+	const FVector StartLocation = PlayerStart ? PlayerStart->GetActorLocation() : FVector::ZeroVector;
+	const FRotator StartRotation = PlayerStart ? PlayerStart->GetActorRotation() : FRotator::ZeroRotator;
+
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	for (int32 Index = 0; Index < Count; Index++) {
+		const int32 BotIndex = Bots.Num();
+
+		// Spread Bots in Rings Around the Start
+		const int32 Ring = BotIndex / SPAWNS_PER_RING + 1;
+		const float Angle = 2.0f * PI * (BotIndex % SPAWNS_PER_RING) / SPAWNS_PER_RING;
+		const FVector Offset(FMath::Cos(Angle), FMath::Sin(Angle), 0.0f);
+
+		APawn* Pawn = World->SpawnActor<APawn>(PawnClass, StartLocation + Offset * Ring * SPAWN_RING_SPACING, StartRotation, SpawnParameters);
+		ASandboxBotController* Bot = Pawn ? World->SpawnActor<ASandboxBotController>(SpawnParameters) : nullptr;
+		if (!Bot) {
+			if (Pawn) Pawn->Destroy();
+			continue;
+		}
+
+		Bot->SetBotSeed(BaseSeed + BotIndex);
+		Bot->Possess(Pawn);
+		Bots.Add(Bot);
+	}
+}
+
+void USandboxBotSubsystem::DestroyBots() {
+	for (ASandboxBotController* Bot : Bots) {
+		if (!Bot) continue;
+		if (Bot->GetPawn()) Bot->GetPawn()->Destroy();
+		Bot->Destroy();
+	}
+
+	Bots.Reset();
+}
+
+int32 USandboxBotSubsystem::GetBotCount() const {
+	return Bots.Num();
+}
+
+const TArray<ASandboxBotController*>& USandboxBotSubsystem::GetBots() const {
+	return Bots;
+}
+
+
+/*--- Sampling Functions ---*/
+
+void USandboxBotSubsystem::StartSampling() {
+	if (!PhysicsStartMarker.IsTickFunctionRegistered()) RegisterPhysicsMarkers();
+
+	CurrentStep = FSandboxBotStepReport();
+	CurrentStep.BotCount = GetBotCount();
+	CurrentStep.StartUsedPhysicalMB = FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+	IsSampling = true;
+}
+
+FSandboxBotStepReport USandboxBotSubsystem::FinishSampling() {
+	IsSampling = false;
+
+	const double FrameCount = FMath::Max(CurrentStep.FrameCount, 1);
+	CurrentStep.AverageFrameMs /= FrameCount;
+	CurrentStep.AverageGameThreadMs /= FrameCount;
+	CurrentStep.AveragePhysicsMs /= FrameCount;
+
+	const FPlatformMemoryStats MemoryStats = FPlatformMemory::GetStats();
+	CurrentStep.UsedPhysicalMB = MemoryStats.UsedPhysical / (1024.0 * 1024.0);
+	CurrentStep.PeakUsedPhysicalMB = MemoryStats.PeakUsedPhysical / (1024.0 * 1024.0);
+
+	UE_LOG(
+		LogSandboxBots, Log,
+		TEXT("%d bots: frame %.2fms (max %.2f), game thread %.2fms (max %.2f), physics %.2fms (max %.2f), memory %.0fMB"),
+		CurrentStep.BotCount,
+		CurrentStep.AverageFrameMs, CurrentStep.MaxFrameMs,
+		CurrentStep.AverageGameThreadMs, CurrentStep.MaxGameThreadMs,
+		CurrentStep.AveragePhysicsMs, CurrentStep.MaxPhysicsMs,
+		CurrentStep.UsedPhysicalMB
+	);
+
+	return CurrentStep;
+}
+
+bool USandboxBotSubsystem::GetIsSampling() const {
+	return IsSampling;
+}
+
+void USandboxBotSubsystem::SampleFrame(float DeltaTime) {
+	const double FrameMs = DeltaTime * 1000.0;
+	const double GameThreadMs = FPlatformTime::ToMilliseconds(GGameThreadTime);
+	const double PhysicsSeconds = PhysicsEndMarker.Timestamp - PhysicsStartMarker.Timestamp;
+	const double PhysicsMs = PhysicsSeconds > 0.0 ? PhysicsSeconds * 1000.0 : 0.0;
+
+	// Averages Hold Running Sums Until Sampling Finishes
+	CurrentStep.FrameCount++;
+	CurrentStep.AverageFrameMs += FrameMs;
+	CurrentStep.AverageGameThreadMs += GameThreadMs;
+	CurrentStep.AveragePhysicsMs += PhysicsMs;
+	CurrentStep.MaxFrameMs = FMath::Max(CurrentStep.MaxFrameMs, FrameMs);
+	CurrentStep.MaxGameThreadMs = FMath::Max(CurrentStep.MaxGameThreadMs, GameThreadMs);
+	CurrentStep.MaxPhysicsMs = FMath::Max(CurrentStep.MaxPhysicsMs, PhysicsMs);
+}
+
+void USandboxBotSubsystem::RegisterPhysicsMarkers() {
+	ULevel* Level = GetWorld()->PersistentLevel;
+
+	PhysicsStartMarker.bCanEverTick = true;
+	PhysicsStartMarker.TickGroup = TG_StartPhysics;
+	PhysicsStartMarker.EndTickGroup = TG_StartPhysics;
+	PhysicsStartMarker.RegisterTickFunction(Level);
+
+	PhysicsEndMarker.bCanEverTick = true;
+	PhysicsEndMarker.TickGroup = TG_PostPhysics;
+	PhysicsEndMarker.EndTickGroup = TG_PostPhysics;
+	PhysicsEndMarker.RegisterTickFunction(Level);
+}
+
+
+/*--- Load Test Functions ---*/
+
+bool USandboxBotSubsystem::ReadLoadTestSettings() {
+	const TCHAR* CommandLine = FCommandLine::Get();
+	if (!FParse::Value(CommandLine, TEXT("SandboxBots="), TargetBotCount) || TargetBotCount <= 0) return false;
+
+	BotsPerStep = TargetBotCount;
+	StepTime = DEFAULT_STEP_TIME;
+	WarmupTime = DEFAULT_WARMUP_TIME;
+	FParse::Value(CommandLine, TEXT("SandboxBotStep="), BotsPerStep);
+	FParse::Value(CommandLine, TEXT("SandboxBotStepTime="), StepTime);
+	FParse::Value(CommandLine, TEXT("SandboxBotWarmup="), WarmupTime);
+	FParse::Value(CommandLine, TEXT("SandboxBotSeed="), BaseSeed);
+	ShouldExitWhenDone = FParse::Param(CommandLine, TEXT("SandboxBotExit"));
+	BotsPerStep = FMath::Clamp(BotsPerStep, 1, TargetBotCount);
+
+	if (!FParse::Value(CommandLine, TEXT("SandboxBotReport="), ReportPath)) {
+		ReportPath = FPaths::Combine(
+			FPaths::ProfilingDir(),
+			TEXT("SandboxBots"),
+			FString::Printf(TEXT("BotScaling-%s.csv"), *FDateTime::Now().ToString())
+		);
+	}
+
+	return true;
+}
+
+void USandboxBotSubsystem::StartStep() {
+	SpawnBots(FMath::Min(BotsPerStep, TargetBotCount - GetBotCount()));
+
+	StepElapsedTime = 0.0f;
+}
+
+void USandboxBotSubsystem::FinishLoadTest() {
+	IsLoadTestRunning = false;
+	WriteReport();
+
+	if (ShouldExitWhenDone) {
+		FPlatformMisc::RequestExit(false);
+	}
+}
+
+void USandboxBotSubsystem::WriteReport() const {
+	FString Report = TEXT("Bots,Frames,AvgFrameMs,MaxFrameMs,AvgGameThreadMs,MaxGameThreadMs,AvgPhysicsMs,MaxPhysicsMs,UsedPhysicalMB,PeakUsedPhysicalMB\n");
+
+	for (const FSandboxBotStepReport& Step : CompletedSteps) {
+		Report += FString::Printf(
+			TEXT("%d,%d,%.3f,%.3f,%.3f,%.3f,%.3f,%.3f,%.1f,%.1f\n"),
+			Step.BotCount, Step.FrameCount,
+			Step.AverageFrameMs, Step.MaxFrameMs,
+			Step.AverageGameThreadMs, Step.MaxGameThreadMs,
+			Step.AveragePhysicsMs, Step.MaxPhysicsMs,
+			Step.UsedPhysicalMB, Step.PeakUsedPhysicalMB
+		);
+	}
+
+	if (FFileHelper::SaveStringToFile(Report, *ReportPath)) {
+		UE_LOG(LogSandboxBots, Log, TEXT("Load test report written to %s"), *ReportPath);
+	} else {
+		UE_LOG(LogSandboxBots, Error, TEXT("Failed to write load test report to %s"), *ReportPath);
+	}
+}
@@ -0,0 +1,137 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SandboxBotSubsystem.generated.h"
+
+class ASandboxBotController;
+
+/*
+ *  SandboxBotSubsystem.h                             Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxBotSubsystem.cpp.
+ */
+
+// Stamps the time its tick group starts, bracketing the physics step.
+struct FSandboxPhysicsMarkerTickFunction : public FTickFunction {
+	double Timestamp = 0.0;
+
+	virtual void ExecuteTick(
+		float DeltaTime,
+		ELevelTick TickType,
+		ENamedThreads::Type CurrentThread,
+		const FGraphEventRef& MyCompletionGraphEvent
+	) override;
+
+	virtual FString DiagnosticMessage() override;
+};
+
+struct FSandboxBotStepReport {
+	int32 BotCount = 0;
+	int32 FrameCount = 0;
+	double AverageFrameMs = 0.0;
+	double MaxFrameMs = 0.0;
+	double AverageGameThreadMs = 0.0;
+	double MaxGameThreadMs = 0.0;
+	double AveragePhysicsMs = 0.0;
+	double MaxPhysicsMs = 0.0;
+	double StartUsedPhysicalMB = 0.0;
+	double UsedPhysicalMB = 0.0;
+	double PeakUsedPhysicalMB = 0.0;
+};
+
+UCLASS()
+class SANDBOX_API USandboxBotSubsystem : public UTickableWorldSubsystem {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	private: const float DEFAULT_STEP_TIME = 30.0f;
+	private: const float DEFAULT_WARMUP_TIME = 5.0f;
+	private: const float SPAWN_RING_SPACING = 150.0f;
+	private: const int32 SPAWNS_PER_RING = 8;
+
+
+	/*--- Variables ---*/
+
+	private: UPROPERTY()
+	TArray<ASandboxBotController*> Bots;
+
+	// Load Test Settings (From the Command Line)
+	private: int32 TargetBotCount = 0;
+	private: int32 BotsPerStep = 0;
+	private: float StepTime = 0.0f;
+	private: float WarmupTime = 0.0f;
+	private: int32 BaseSeed = 0;
+	private: bool ShouldExitWhenDone = false;
+	private: FString ReportPath;
+
+	// Current Step
+	private: bool IsLoadTestRunning = false;
+	private: float StepElapsedTime = 0.0f;
+	private: TArray<FSandboxBotStepReport> CompletedSteps;
+
+	// Current Sample
+	private: bool IsSampling = false;
+	private: FSandboxBotStepReport CurrentStep;
+
+	private: FSandboxPhysicsMarkerTickFunction PhysicsStartMarker;
+	private: FSandboxPhysicsMarkerTickFunction PhysicsEndMarker;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	public: virtual void Deinitialize() override;
+
+	public: virtual void Tick(float DeltaTime) override;
+
+	public: virtual TStatId GetStatId() const override;
+
+	protected: virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+
+	/*--- Bot Functions ---*/
+
+	/** Spawns bots driving the game mode's first person pawn around the level's player start. **/
+	public: void SpawnBots(int32 Count);
+
+	public: void DestroyBots();
+
+	public: int32 GetBotCount() const;
+
+	public: const TArray<ASandboxBotController*>& GetBots() const;
+
+
+	/*--- Sampling Functions ---*/
+
+	/** Starts recording frame, game thread and physics times, one sample per frame until finished. **/
+	public: void StartSampling();
+
+	/** Stops recording and returns the averaged sample, stamped with current memory use. **/
+	public: FSandboxBotStepReport FinishSampling();
+
+	public: bool GetIsSampling() const;
+
+	private: void SampleFrame(float DeltaTime);
+
+	private: void RegisterPhysicsMarkers();
+
+
+	/*--- Load Test Functions ---*/
+
+	/** Parses -SandboxBots=N and friends. Returns false if no load test was requested. **/
+	private: bool ReadLoadTestSettings();
+
+	private: void StartStep();
+
+	private: void FinishLoadTest();
+
+	private: void WriteReport() const;
+
+};
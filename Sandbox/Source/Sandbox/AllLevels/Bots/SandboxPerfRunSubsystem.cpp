@@ -0,0 +1,460 @@
+
+#include "SandboxPerfRunSubsystem.h"
+#include "Dom/JsonObject.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "Kismet/GameplayStatics.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "AllLevels/Utility/SandboxMemory.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSandboxPerf, Log, All);
+
+/*
+ *  SandboxPerfRunSubsystem.cpp                       Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxPerfRunSubsystem is a headless performance regression
+ *  run. It travels StartMap -> LoadingMap -> FirstPersonMap, spawns
+ *  scripted bots and measures each phase of a fixed sequence (walk,
+ *  fly, grab, ride a platform) through SandboxBotSubsystem. Results
+ *  are written as JSON and compared against a stored baseline, and
+ *  the process exits nonzero when a metric regresses. Runs on a GPU-
+ *  and Steam-less Linux box with:
+ *
+ *    Sandbox -nullrhi -nosound -nosteam -unattended -SandboxPerfRun
+ *
+ *    -SandboxPerfBots=N          Bots per phase (Default: 8)
+ *    -SandboxPerfPhaseTime=T     Seconds measured per phase (Default: 20)
+ *    -SandboxPerfWarmup=W        Seconds ignored per phase (Default: 5)
+ *    -SandboxPerfTimeout=T       Seconds before the run fails (Default: 600)
+ *    -SandboxPerfThreshold=X     Allowed relative growth (Default: 0.15)
+ *    -SandboxPerfReport=Path     JSON output (Default: Saved/Profiling/SandboxPerf)
+ *    -SandboxPerfBaseline=Path   Baseline (Default: PerfBaselines/<Platform>.json)
+ *    -SandboxPerfWriteBaseline   Store this run as the new baseline
+ *    -SandboxPerfMemory          Repeat the route & fail on memory leaks
+ *
+ *  Exit Codes
+ *    - 0: Passed, or a new baseline was written.
+ *    - 1: At least one gated metric regressed.
+ *    - 2: The run itself failed (travel, spawning, timeout, or no
+ *         baseline to compare against).
+ *
+ *  Note: Averages of frame, game thread and physics time plus the
+ *        memory each phase grows by are gated. Maximums and the
+ *        process's peak memory (Which Carries Over From Earlier
+ *        Phases) are reported but not failed on.
+ *
+ *  Note: With -SandboxPerfMemory the route is traveled enough extra
+ *        times for SandboxMemory to check its round trips before the
+ *        phases run, and every leak it finds counts as a regression.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+bool USandboxPerfRunSubsystem::ShouldCreateSubsystem(UObject* Outer) const {
+	return FParse::Param(FCommandLine::Get(), TEXT("SandboxPerfRun")) && Super::ShouldCreateSubsystem(Outer);
+}
+
+void USandboxPerfRunSubsystem::Initialize(FSubsystemCollectionBase& Collection) {
+	Super::Initialize(Collection);
+
+	ReadRunSettings();
+	UE_LOG(LogSandboxPerf, Log, TEXT("Perf run: %d bots, %.0fs per phase, baseline %s"), BotCount, PhaseTime, *BaselinePath);
+
+	// Game Instance Starts Before the Default Map, So Its Load Is Timed Too
+	TravelStartTime = FPlatformTime::Seconds();
+	FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &USandboxPerfRunSubsystem::OnPostLoadMap);
+	TickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &USandboxPerfRunSubsystem::Tick));
+}
+
+void USandboxPerfRunSubsystem::Deinitialize() {
+	FTSTicker::GetCoreTicker().RemoveTicker(TickerHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.RemoveAll(this);
+
+	Super::Deinitialize();
+}
+
+bool USandboxPerfRunSubsystem::Tick(float DeltaTime) {
+	TRACE_CPUPROFILER_EVENT_SCOPE(USandboxPerfRunSubsystem::Tick);
+	if (State == ESandboxPerfRunState::Finished) return true;
+
+	RunElapsedTime += DeltaTime;
+	StateElapsedTime += DeltaTime;
+	if (RunElapsedTime > Timeout) {
+		FailRun(FString::Printf(TEXT("Timed out after %.0fs"), Timeout));
+		return true;
+	}
+
+	switch (State) {
+		case ESandboxPerfRunState::Settling:
+			if (StateElapsedTime < SETTLE_TIME) break;
+
+			if (RouteIndex < ROUTE.Num()) {
+				TravelToNextMap();
+			} else if (RouteRepeatsLeft > 0) {
+				RouteRepeatsLeft--;
+				RouteIndex = 0;
+				TravelToNextMap();
+			} else if (GetCurrentMapName() != FPackageName::GetShortName(ROUTE.Last())) {
+				FailRun(FString::Printf(TEXT("Left the route for %s"), *GetCurrentMapName()));
+			} else if (SpawnBots()) {
+				StartPhase(0);
+			}
+			break;
+
+		case ESandboxPerfRunState::Warmup: {
+			if (StateElapsedTime < WarmupTime) break;
+
+			USandboxBotSubsystem* BotSubsystem = GetBotSubsystem();
+			if (!BotSubsystem) {
+				FailRun(TEXT("Bot subsystem is missing, can't sample"));
+				break;
+			}
+
+			BotSubsystem->StartSampling();
+			SetState(ESandboxPerfRunState::Measuring);
+			break;
+		}
+
+		case ESandboxPerfRunState::Measuring:
+			if (StateElapsedTime < PhaseTime) break;
+
+			FinishPhase();
+			break;
+
+		default:
+			break;
+	}
+
+	return true;
+}
+
+
+/*--- Route Functions ---*/
+
+void USandboxPerfRunSubsystem::OnPostLoadMap(UWorld* LoadedWorld) {
+	if (!LoadedWorld || State == ESandboxPerfRunState::Finished) return;
+
+	const FString MapName = UWorld::RemovePIEPrefix(LoadedWorld->GetMapName());
+	const double LoadTime = FPlatformTime::Seconds() - TravelStartTime;
+	MapLoadTimes.Emplace(MapName, LoadTime);
+	UE_LOG(LogSandboxPerf, Log, TEXT("Loaded %s in %.2fs"), *MapName, LoadTime);
+
+	// Maps Opened Along the Way (Menus, Level Scripts) Are Timed but Don't Advance the Route
+	if (RouteIndex < ROUTE.Num() && MapName == FPackageName::GetShortName(ROUTE[RouteIndex])) {
+		RouteIndex++;
+	}
+
+	SetState(ESandboxPerfRunState::Settling);
+}
+
+void USandboxPerfRunSubsystem::TravelToNextMap() {
+	UE_LOG(LogSandboxPerf, Log, TEXT("Traveling to %s"), *ROUTE[RouteIndex]);
+
+	TravelStartTime = FPlatformTime::Seconds();
+	SetState(ESandboxPerfRunState::Traveling);
+	UGameplayStatics::OpenLevel(GetGameInstance()->GetWorld(), FName(*ROUTE[RouteIndex]));
+}
+
+FString USandboxPerfRunSubsystem::GetCurrentMapName() const {
+	UWorld* World = GetGameInstance()->GetWorld();
+	return World ? UWorld::RemovePIEPrefix(World->GetMapName()) : FString();
+}
+
+
+/*--- Phase Functions ---*/
+
+USandboxBotSubsystem* USandboxPerfRunSubsystem::GetBotSubsystem() const {
+	UWorld* World = GetGameInstance()->GetWorld();
+	return World ? World->GetSubsystem<USandboxBotSubsystem>() : nullptr;
+}
+
+bool USandboxPerfRunSubsystem::SpawnBots() {
+	USandboxBotSubsystem* BotSubsystem = GetBotSubsystem();
+	if (BotSubsystem) BotSubsystem->SpawnBots(BotCount);
+
+	if (!BotSubsystem || BotSubsystem->GetBotCount() == 0) {
+		FailRun(TEXT("No bots could be spawned"));
+		return false;
+	}
+
+	// Every Bot Follows the Script
+	for (ASandboxBotController* Bot : BotSubsystem->GetBots()) {
+		if (Bot) Bot->RandomizeBehavior = false;
+	}
+
+	return true;
+}
+
+void USandboxPerfRunSubsystem::StartPhase(int32 Index) {
+	PhaseIndex = Index;
+	UE_LOG(LogSandboxPerf, Log, TEXT("Phase %s"), *PHASE_NAMES[PhaseIndex]);
+
+	USandboxBotSubsystem* BotSubsystem = GetBotSubsystem();
+	if (!BotSubsystem) {
+		FailRun(FString::Printf(TEXT("Bot subsystem is missing, can't start %s"), *PHASE_NAMES[PhaseIndex]));
+		return;
+	}
+
+	for (ASandboxBotController* Bot : BotSubsystem->GetBots()) {
+		if (Bot) Bot->SetScriptedBehavior(PHASE_BEHAVIORS[PhaseIndex]);
+	}
+
+	SetState(ESandboxPerfRunState::Warmup);
+}
+
+void USandboxPerfRunSubsystem::FinishPhase() {
+	USandboxBotSubsystem* BotSubsystem = GetBotSubsystem();
+	if (!BotSubsystem) {
+		FailRun(FString::Printf(TEXT("Bot subsystem is missing, can't finish %s"), *PHASE_NAMES[PhaseIndex]));
+		return;
+	}
+
+	PhaseReports.Add(BotSubsystem->FinishSampling());
+
+	if (PhaseIndex + 1 < PHASE_NAMES.Num()) {
+		StartPhase(PhaseIndex + 1);
+	} else {
+		FinishRun();
+	}
+}
+
+void USandboxPerfRunSubsystem::SetState(ESandboxPerfRunState NewState) {
+	State = NewState;
+	StateElapsedTime = 0.0f;
+}
+
+
+/*--- Report Functions ---*/
+
+void USandboxPerfRunSubsystem::ReadRunSettings() {
+	const TCHAR* CommandLine = FCommandLine::Get();
+
+	BotCount = DEFAULT_BOT_COUNT;
+	PhaseTime = DEFAULT_PHASE_TIME;
+	WarmupTime = DEFAULT_WARMUP_TIME;
+	Timeout = DEFAULT_TIMEOUT;
+	RegressionThreshold = DEFAULT_REGRESSION_THRESHOLD;
+	FParse::Value(CommandLine, TEXT("SandboxPerfBots="), BotCount);
+	FParse::Value(CommandLine, TEXT("SandboxPerfPhaseTime="), PhaseTime);
+	FParse::Value(CommandLine, TEXT("SandboxPerfWarmup="), WarmupTime);
+	FParse::Value(CommandLine, TEXT("SandboxPerfTimeout="), Timeout);
+	FParse::Value(CommandLine, TEXT("SandboxPerfThreshold="), RegressionThreshold);
+	ShouldWriteBaseline = FParse::Param(CommandLine, TEXT("SandboxPerfWriteBaseline"));
+	ShouldCheckMemory = FParse::Param(CommandLine, TEXT("SandboxPerfMemory"));
+	BotCount = FMath::Max(BotCount, 1);
+
+	// The First Pass Only Warms Caches, Each Repeat Is One Round Trip per Map
+	RouteRepeatsLeft = ShouldCheckMemory ? FSandboxMemory::Get().GetRoundTrips() + 1 : 0;
+
+	if (!FParse::Value(CommandLine, TEXT("SandboxPerfReport="), ReportPath)) {
+		ReportPath = FPaths::Combine(
+			FPaths::ProfilingDir(),
+			TEXT("SandboxPerf"),
+			FString::Printf(TEXT("PerfRun-%s.json"), *FDateTime::Now().ToString())
+		);
+	}
+
+	// Baselines Are Per Platform, a Linux Host Won't Match a Windows Desktop
+	if (!FParse::Value(CommandLine, TEXT("SandboxPerfBaseline="), BaselinePath)) {
+		BaselinePath = FPaths::Combine(
+			FPaths::ProjectDir(),
+			TEXT("PerfBaselines"),
+			FString::Printf(TEXT("%s.json"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()))
+		);
+	}
+}
+
+void USandboxPerfRunSubsystem::FinishRun() {
+	TSharedRef<FJsonObject> Report = BuildReport();
+
+	if (ShouldWriteBaseline) {
+		const bool IsBaselineWritten = WriteJson(Report, BaselinePath);
+		WriteJson(Report, ReportPath);
+		ExitRun(IsBaselineWritten ? 0 : EXIT_CODE_FAILURE);
+		return;
+	}
+
+	// A Missing Baseline Must Not Pass the Gate Silently
+	const TSharedPtr<FJsonObject> Baseline = ReadBaseline();
+	if (!Baseline.IsValid()) {
+		FailRun(FString::Printf(TEXT("No baseline at %s, run with -SandboxPerfWriteBaseline to store one"), *BaselinePath));
+		return;
+	}
+
+	const int32 RegressionCount = CompareToBaseline(Report, Baseline.ToSharedRef()) + AddMemoryLeaks(Report);
+	Report->SetBoolField(TEXT("Passed"), RegressionCount == 0);
+	if (!WriteJson(Report, ReportPath)) {
+		ExitRun(EXIT_CODE_FAILURE);
+		return;
+	}
+
+	if (RegressionCount > 0) {
+		UE_LOG(LogSandboxPerf, Error, TEXT("Perf run failed: %d regressed metrics"), RegressionCount);
+		ExitRun(EXIT_CODE_REGRESSION);
+	} else {
+		UE_LOG(LogSandboxPerf, Log, TEXT("Perf run passed"));
+		ExitRun(0);
+	}
+}
+
+void USandboxPerfRunSubsystem::FailRun(const FString& Reason) {
+	UE_LOG(LogSandboxPerf, Error, TEXT("Perf run failed: %s"), *Reason);
+
+	// Keep Whatever Was Measured
+	TSharedRef<FJsonObject> Report = BuildReport();
+	Report->SetStringField(TEXT("Error"), Reason);
+	Report->SetBoolField(TEXT("Passed"), false);
+	WriteJson(Report, ReportPath);
+
+	ExitRun(EXIT_CODE_FAILURE);
+}
+
+TSharedRef<FJsonObject> USandboxPerfRunSubsystem::BuildReport() const {
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("Platform"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+	Report->SetStringField(TEXT("Configuration"), LexToString(FApp::GetBuildConfiguration()));
+	Report->SetStringField(TEXT("Timestamp"), FDateTime::UtcNow().ToIso8601());
+	Report->SetNumberField(TEXT("Bots"), BotCount);
+	Report->SetNumberField(TEXT("PhaseTime"), PhaseTime);
+
+	TArray<TSharedPtr<FJsonValue>> MapLoads;
+	for (const TPair<FString, double>& MapLoad : MapLoadTimes) {
+		TSharedRef<FJsonObject> MapLoadJson = MakeShared<FJsonObject>();
+		MapLoadJson->SetStringField(TEXT("Map"), MapLoad.Key);
+		MapLoadJson->SetNumberField(TEXT("Seconds"), MapLoad.Value);
+		MapLoads.Add(MakeShared<FJsonValueObject>(MapLoadJson));
+	}
+	Report->SetArrayField(TEXT("MapLoads"), MapLoads);
+
+	TArray<TSharedPtr<FJsonValue>> Phases;
+	for (int32 Index = 0; Index < PhaseReports.Num(); Index++) {
+		const FSandboxBotStepReport& Phase = PhaseReports[Index];
+
+		TSharedRef<FJsonObject> PhaseJson = MakeShared<FJsonObject>();
+		PhaseJson->SetStringField(TEXT("Name"), PHASE_NAMES[Index]);
+		PhaseJson->SetNumberField(TEXT("Bots"), Phase.BotCount);
+		PhaseJson->SetNumberField(TEXT("Frames"), Phase.FrameCount);
+		PhaseJson->SetNumberField(TEXT("AvgFrameMs"), Phase.AverageFrameMs);
+		PhaseJson->SetNumberField(TEXT("MaxFrameMs"), Phase.MaxFrameMs);
+		PhaseJson->SetNumberField(TEXT("AvgGameThreadMs"), Phase.AverageGameThreadMs);
+		PhaseJson->SetNumberField(TEXT("MaxGameThreadMs"), Phase.MaxGameThreadMs);
+		PhaseJson->SetNumberField(TEXT("AvgPhysicsMs"), Phase.AveragePhysicsMs);
+		PhaseJson->SetNumberField(TEXT("MaxPhysicsMs"), Phase.MaxPhysicsMs);
+		PhaseJson->SetNumberField(TEXT("UsedPhysicalMB"), Phase.UsedPhysicalMB);
+		PhaseJson->SetNumberField(TEXT("UsedPhysicalGrowthMB"), Phase.UsedPhysicalMB - Phase.StartUsedPhysicalMB);
+		PhaseJson->SetNumberField(TEXT("PeakUsedPhysicalMB"), Phase.PeakUsedPhysicalMB);
+		Phases.Add(MakeShared<FJsonValueObject>(PhaseJson));
+	}
+	Report->SetArrayField(TEXT("Phases"), Phases);
+
+	return Report;
+}
+
+TSharedPtr<FJsonObject> USandboxPerfRunSubsystem::ReadBaseline() const {
+	FString BaselineText;
+	TSharedPtr<FJsonObject> Baseline;
+	if (!FFileHelper::LoadFileToString(BaselineText, *BaselinePath)
+		|| !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(BaselineText), Baseline)) {
+		return nullptr;
+	}
+
+	return Baseline;
+}
+
+int32 USandboxPerfRunSubsystem::CompareToBaseline(const TSharedRef<FJsonObject>& Report, const TSharedRef<FJsonObject>& Baseline) const {
+	// Gated Metrics & Their Absolute Noise Floors
+	const TArray<TPair<FString, double>> GatedMetrics = {
+		{ TEXT("AvgFrameMs"), MIN_REGRESSION_MS },
+		{ TEXT("AvgGameThreadMs"), MIN_REGRESSION_MS },
+		{ TEXT("AvgPhysicsMs"), MIN_REGRESSION_MS },
+		{ TEXT("UsedPhysicalGrowthMB"), MIN_REGRESSION_MB }
+	};
+
+	const TArray<TSharedPtr<FJsonValue>>* BaselinePhases = nullptr;
+	Baseline->TryGetArrayField(TEXT("Phases"), BaselinePhases);
+
+	TArray<TSharedPtr<FJsonValue>> Regressions;
+	for (const TSharedPtr<FJsonValue>& PhaseValue : Report->GetArrayField(TEXT("Phases"))) {
+		const TSharedPtr<FJsonObject> Phase = PhaseValue->AsObject();
+		const FString PhaseName = Phase->GetStringField(TEXT("Name"));
+
+		// Match Phases by Name, New Phases Have Nothing to Regress From
+		TSharedPtr<FJsonObject> BaselinePhase;
+		if (BaselinePhases) {
+			for (const TSharedPtr<FJsonValue>& BaselineValue : *BaselinePhases) {
+				if (BaselineValue->AsObject()->GetStringField(TEXT("Name")) == PhaseName) {
+					BaselinePhase = BaselineValue->AsObject();
+				}
+			}
+		}
+		if (!BaselinePhase) continue;
+
+		for (const TPair<FString, double>& Metric : GatedMetrics) {
+			double Current = 0.0;
+			double Expected = 0.0;
+			if (!Phase->TryGetNumberField(Metric.Key, Current) || !BaselinePhase->TryGetNumberField(Metric.Key, Expected)) continue;
+			if (Current <= Expected * (1.0 + RegressionThreshold) || Current - Expected <= Metric.Value) continue;
+
+			UE_LOG(LogSandboxPerf, Error, TEXT("%s %s regressed: %.2f (baseline %.2f)"), *PhaseName, *Metric.Key, Current, Expected);
+
+			TSharedRef<FJsonObject> Regression = MakeShared<FJsonObject>();
+			Regression->SetStringField(TEXT("Phase"), PhaseName);
+			Regression->SetStringField(TEXT("Metric"), Metric.Key);
+			Regression->SetNumberField(TEXT("Value"), Current);
+			Regression->SetNumberField(TEXT("Baseline"), Expected);
+			Regressions.Add(MakeShared<FJsonValueObject>(Regression));
+		}
+	}
+
+	Report->SetArrayField(TEXT("Regressions"), Regressions);
+	return Regressions.Num();
+}
+
+int32 USandboxPerfRunSubsystem::AddMemoryLeaks(const TSharedRef<FJsonObject>& Report) const {
+	if (!ShouldCheckMemory) return 0;
+
+	TArray<TSharedPtr<FJsonValue>> Leaks;
+	for (const FSandboxMemoryLeak& Leak : FSandboxMemory::Get().FindLeaks()) {
+		UE_LOG(LogSandboxPerf, Error, TEXT("%s %s leaked: grew %lld over %d round trips"), *Leak.Map, *Leak.Metric, Leak.Growth, Leak.RoundTrips);
+
+		TSharedRef<FJsonObject> LeakJson = MakeShared<FJsonObject>();
+		LeakJson->SetStringField(TEXT("Map"), Leak.Map);
+		LeakJson->SetStringField(TEXT("Metric"), Leak.Metric);
+		LeakJson->SetNumberField(TEXT("Growth"), Leak.Growth);
+		LeakJson->SetNumberField(TEXT("RoundTrips"), Leak.RoundTrips);
+		Leaks.Add(MakeShared<FJsonValueObject>(LeakJson));
+	}
+
+	Report->SetArrayField(TEXT("MemoryLeaks"), Leaks);
+	return Leaks.Num();
+}
+
+bool USandboxPerfRunSubsystem::WriteJson(const TSharedRef<FJsonObject>& Json, const FString& Path) const {
+	FString Output;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+	FJsonSerializer::Serialize(Json, Writer);
+
+	if (!FFileHelper::SaveStringToFile(Output, *Path)) {
+		UE_LOG(LogSandboxPerf, Error, TEXT("Failed to write %s"), *Path);
+		return false;
+	}
+
+	UE_LOG(LogSandboxPerf, Log, TEXT("Wrote %s"), *Path);
+	return true;
+}
+
+void USandboxPerfRunSubsystem::ExitRun(uint8 ExitCode) {
+	SetState(ESandboxPerfRunState::Finished);
+	FPlatformMisc::RequestExitWithStatus(false, ExitCode);
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "SandboxBotController.h"
+#include "SandboxBotSubsystem.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "SandboxPerfRunSubsystem.generated.h"
+
+class FJsonObject;
+
+/*
+ *  SandboxPerfRunSubsystem.h                         Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxPerfRunSubsystem.cpp.
+ */
+
+enum class ESandboxPerfRunState : uint8 {
+	Traveling,
+	Settling,
+	Warmup,
+	Measuring,
+	Finished
+};
+
+UCLASS()
+class SANDBOX_API USandboxPerfRunSubsystem : public UGameInstanceSubsystem {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	// Maps Visited in Order, Measured on the Last
+	private: const TArray<FString> ROUTE = {
+		TEXT("/Game/StartLevel/StartMap"),
+		TEXT("/Game/LoadingLevel/LoadingMap"),
+		TEXT("/Game/FirstPersonLevel/FirstPersonMap")
+	};
+
+	// Scripted Sequence (Parallel Arrays)
+	private: const TArray<FString> PHASE_NAMES = { TEXT("Walk"), TEXT("Fly"), TEXT("Grab"), TEXT("RidePlatform") };
+	private: const TArray<ESandboxBotBehavior> PHASE_BEHAVIORS = {
+		ESandboxBotBehavior::Wander,
+		ESandboxBotBehavior::Fly,
+		ESandboxBotBehavior::Grab,
+		ESandboxBotBehavior::RidePlatform
+	};
+
+	private: const float SETTLE_TIME = 2.0f;
+	private: const int32 DEFAULT_BOT_COUNT = 8;
+	private: const float DEFAULT_PHASE_TIME = 20.0f;
+	private: const float DEFAULT_WARMUP_TIME = 5.0f;
+	private: const float DEFAULT_TIMEOUT = 600.0f;
+
+	// Regressions Must Clear Both the Relative Threshold and an Absolute Floor (Noise)
+	private: const double DEFAULT_REGRESSION_THRESHOLD = 0.15;
+	private: const double MIN_REGRESSION_MS = 0.5;
+	private: const double MIN_REGRESSION_MB = 64.0;
+
+	private: const uint8 EXIT_CODE_REGRESSION = 1;
+	private: const uint8 EXIT_CODE_FAILURE = 2;
+
+
+	/*--- Variables ---*/
+
+	// Run Settings (From the Command Line)
+	private: int32 BotCount = 0;
+	private: float PhaseTime = 0.0f;
+	private: float WarmupTime = 0.0f;
+	private: float Timeout = 0.0f;
+	private: double RegressionThreshold = 0.0;
+	private: FString ReportPath;
+	private: FString BaselinePath;
+	private: bool ShouldWriteBaseline = false;
+	private: bool ShouldCheckMemory = false;
+
+	// Run State
+	private: FTSTicker::FDelegateHandle TickerHandle;
+	private: ESandboxPerfRunState State = ESandboxPerfRunState::Traveling;
+	private: float StateElapsedTime = 0.0f;
+	private: float RunElapsedTime = 0.0f;
+	private: double TravelStartTime = 0.0;
+	private: int32 RouteIndex = 0;
+	private: int32 RouteRepeatsLeft = 0;
+	private: int32 PhaseIndex = 0;
+	private: TArray<TPair<FString, double>> MapLoadTimes;
+	private: TArray<FSandboxBotStepReport> PhaseReports;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	/** Only exists when the game is launched with -SandboxPerfRun. **/
+	public: virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+
+	public: virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	public: virtual void Deinitialize() override;
+
+	// Core Ticker, Keeps Running Across Map Travel
+	private: bool Tick(float DeltaTime);
+
+
+	/*--- Route Functions ---*/
+
+	private: void OnPostLoadMap(UWorld* LoadedWorld);
+
+	private: void TravelToNextMap();
+
+	private: FString GetCurrentMapName() const;
+
+
+	/*--- Phase Functions ---*/
+
+	private: USandboxBotSubsystem* GetBotSubsystem() const;
+
+	private: bool SpawnBots();
+
+	private: void StartPhase(int32 Index);
+
+	private: void FinishPhase();
+
+	private: void SetState(ESandboxPerfRunState NewState);
+
+
+	/*--- Report Functions ---*/
+
+	private: void ReadRunSettings();
+
+	private: void FinishRun();
+
+	private: void FailRun(const FString& Reason);
+
+	private: TSharedRef<FJsonObject> BuildReport() const;
+
+	/** The stored baseline, or null when there is none (Which Fails the Run). **/
+	private: TSharedPtr<FJsonObject> ReadBaseline() const;
+
+	/** Adds a Regressions array to the report. Returns the number of regressed metrics. **/
+	private: int32 CompareToBaseline(const TSharedRef<FJsonObject>& Report, const TSharedRef<FJsonObject>& Baseline) const;
+
+	/** Adds a MemoryLeaks array to the report. Returns the number of leaks found across the route's round trips. **/
+	private: int32 AddMemoryLeaks(const TSharedRef<FJsonObject>& Report) const;
+
+	private: bool WriteJson(const TSharedRef<FJsonObject>& Json, const FString& Path) const;
+
+	private: void ExitRun(uint8 ExitCode);
+
+};
@@ -6,9 +6,12 @@
 #include "ControllerDiagnosticWidget.h"
 #include "FirstPersonHUD.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PlayerController.h"
 #include "GrabComponent.h"
 #include "GrabbableComponent.h"
+#include "SandboxCharacterMovementComponent.h"
 #include "AllLevels/Input/GamepadLookAdapter.h"
+#include "AllLevels/Utility/SandboxLog.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogFPChar, Warning, All);
 
@@ -24,7 +27,8 @@ DEFINE_LOG_CATEGORY_STATIC(LogFPChar, Warning, All);
 
 /*--- Lifecycle Functions ---*/
 
-AFirstPersonCharacter::AFirstPersonCharacter() {
+AFirstPersonCharacter::AFirstPersonCharacter(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<USandboxCharacterMovementComponent>(ACharacter::CharacterMovementComponentName)) {
 
 	// Setup Capsule & Camera
 	GetCapsuleComponent()->InitCapsuleSize(DEFAULT_CAPSULE_RADIUS, DEFAULT_CAPSULE_HEIGHT);
@@ -33,23 +37,50 @@ AFirstPersonCharacter::AFirstPersonCharacter() {
 	FirstPersonCameraComponent->SetRelativeLocation(FVector(0.0f, 0.0f, DEFAULT_EYE_HEIGHT));
 	FirstPersonCameraComponent->bUsePawnControlRotation = true;
 
+	// Setup Grab Component (Default Subobject So It Replicates)
+	GrabComponent = CreateDefaultSubobject<UGrabComponent>(TEXT("GrabComponent"));
+
 	// Configure Movement
-	IsFlying = false;
 	GetCharacterMovement()->JumpZVelocity = DEFAULT_JUMP_VELOCITY;
 	GetCharacterMovement()->AirControl = DEFAULT_AIR_CONTROL;
 	GetCharacterMovement()->BrakingDecelerationFlying = 1000.0f;
+
+	// Configure Flight (Predicted by the Movement Component)
+	SandboxMovementComponent = Cast<USandboxCharacterMovementComponent>(GetCharacterMovement());
+	SandboxMovementComponent->FlyingCapsuleHalfHeight = DEFAULT_CAPSULE_RADIUS;
+	SandboxMovementComponent->FlyingCapsuleRaise = DEFAULT_EYE_HEIGHT;
+	SandboxMovementComponent->FlightThrustScale = FLIGHT_VERTICAL_SPEED;
 }
 
 void AFirstPersonCharacter::BeginPlay() {
 	Super::BeginPlay();
 
 	SetupGamepadLookAdapter();
-	SetupGrabComponent();
 	SetupFirstPersonHUD();
 }
 
-void AFirstPersonCharacter::Tick(float DeltaSeconds) {
-	Super::Tick(DeltaSeconds);
+
+void AFirstPersonCharacter::NotifyControllerChanged() {
+	Super::NotifyControllerChanged();
+
+	// Pawns Spawned Before Possession Pick Up Their HUD Here
+	SetupFirstPersonHUD();
+}
+
+void AFirstPersonCharacter::OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode) {
+	Super::OnMovementModeChanged(PrevMovementMode, PreviousCustomMode);
+
+	// Movement Component Has Already Resized the Capsule
+	const bool WasFlying = PrevMovementMode == MOVE_Flying;
+	if (WasFlying == IsFlying()) return;
+
+	if (IsFlying()) {
+		FirstPersonCameraComponent->SetRelativeLocation(FVector(0.0f, 0.0f, 0.0f));
+		if (IsLocallyControlled()) SANDBOX_LOG(Movement, "Flying");
+	} else {
+		FirstPersonCameraComponent->SetRelativeLocation(FVector(0.0f, 0.0f, DEFAULT_EYE_HEIGHT));
+		if (IsLocallyControlled()) SANDBOX_LOG(Movement, "Walking");
+	}
 }
 
 
@@ -59,15 +90,18 @@ void AFirstPersonCharacter::SetupGamepadLookAdapter() {
 	GamepadLookAdapter = NewObject<UGamepadLookAdapter>(this);
 }
 
-void AFirstPersonCharacter::SetupGrabComponent() {
-	UPhysicsHandleComponent *PhysicsComponent = NewObject<UPhysicsHandleComponent>(this);
-	PhysicsComponent->RegisterComponent();
-	GrabComponent = NewObject<UGrabComponent>(this);
-	GrabComponent->RegisterComponent();
+void AFirstPersonCharacter::SetupFirstPersonHUD() {
+#if !UE_SERVER
+	APlayerController* PlayerController = Cast<APlayerController>(GetController());
+	FirstPersonHUD = PlayerController ? Cast<AFirstPersonHUD>(PlayerController->GetHUD()) : nullptr;
+#endif
 }
 
-void AFirstPersonCharacter::SetupFirstPersonHUD() {
-	FirstPersonHUD = Cast<AFirstPersonHUD>(GetWorld()->GetFirstPlayerController()->GetHUD());
+
+/*--- Movement Functions ---*/
+
+bool AFirstPersonCharacter::IsFlying() const {
+	return GetCharacterMovement()->IsFlying();
 }
 
 
@@ -84,10 +118,9 @@ void AFirstPersonCharacter::OnMouseVertical(float Input) {
 void AFirstPersonCharacter::OnStickLeft(FVector2D Input) {
 	AInputCharacter::OnStickLeft(Input);
 
-	if (IsFlying) {
+	if (IsFlying()) {
 		AddMovementInput(FirstPersonCameraComponent->GetForwardVector(), Input.Y);
 		AddMovementInput(FirstPersonCameraComponent->GetRightVector(), Input.X);
-		AddMovementInput(FirstPersonCameraComponent->GetUpVector(), VerticalForceUp + VerticalForceDown);
 	} else {
 		AddMovementInput(GetActorForwardVector(), Input.Y);
 		AddMovementInput(GetActorRightVector(), Input.X);
@@ -105,11 +138,7 @@ void AFirstPersonCharacter::OnStickRight(FVector2D Input) {
 void AFirstPersonCharacter::OnFaceRightPress() {
 	AInputCharacter::OnFaceRightPress();
 	if (IsGrabEnabled) {
-		if (GrabComponent->IsGrabbing) {
-			GrabComponent->ReleaseObject();
-		} else {
-			GrabComponent->GrabObject();
-		}
+		GrabComponent->GrabOrReleaseObject();
 	}
 }
 
@@ -125,57 +154,33 @@ void AFirstPersonCharacter::OnFaceBottomRelease() {
 
 void AFirstPersonCharacter::OnBumperLeftPress() {
 	AInputCharacter::OnBumperLeftPress();
-	if (IsFlying) {
-		VerticalForceDown = -FLIGHT_VERTICAL_SPEED;
+	if (IsFlying()) {
+		SandboxMovementComponent->SetThrustDown(true);
 	} else {
-		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Bumper Left");
+		SANDBOX_LOG(Movement, "Bumper Left");
 	}
 }
 
 void AFirstPersonCharacter::OnBumperLeftRelease() {
 	AInputCharacter::OnBumperLeftRelease();
-	VerticalForceDown = 0.0f;
+	SandboxMovementComponent->SetThrustDown(false);
 }
 
 void AFirstPersonCharacter::OnBumperRightPress() {
 	AInputCharacter::OnBumperRightPress();
-	if (IsFlying) {
-		VerticalForceUp = FLIGHT_VERTICAL_SPEED;
+	if (IsFlying()) {
+		SandboxMovementComponent->SetThrustUp(true);
 	}
 }
 
 void AFirstPersonCharacter::OnBumperRightRelease() {
 	AInputCharacter::OnBumperRightRelease();
-	if (IsFlying) {
-		VerticalForceUp = 0.0f;
-	}
+	SandboxMovementComponent->SetThrustUp(false);
 }
 
 void AFirstPersonCharacter::OnDPadUpPress() {
 	AInputCharacter::OnDPadUpPress();
-	IsFlying = !IsFlying;
-
-	if (IsFlying) {
-
-		GetCharacterMovement()->SetMovementMode(MOVE_Flying);
-		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Flying");
-		GetCapsuleComponent()->SetCapsuleHalfHeight(DEFAULT_CAPSULE_RADIUS);
-		GetCapsuleComponent()->SetRelativeLocation(FVector(
-			GetCapsuleComponent()->GetRelativeLocation().X, 
-			GetCapsuleComponent()->GetRelativeLocation().Y, 
-			GetCapsuleComponent()->GetRelativeLocation().Z + DEFAULT_EYE_HEIGHT
-		));
-		FirstPersonCameraComponent->SetRelativeLocation(FVector(0.0f, 0.0f, 0.0f));
-	} else {
 
-		GetCharacterMovement()->SetMovementMode(MOVE_Walking);
-		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Walking");
-		GetCapsuleComponent()->SetCapsuleHalfHeight(DEFAULT_CAPSULE_HEIGHT);
-		GetCapsuleComponent()->SetRelativeLocation(FVector(
-			GetCapsuleComponent()->GetRelativeLocation().X, 
-			GetCapsuleComponent()->GetRelativeLocation().Y, 
-			GetCapsuleComponent()->GetRelativeLocation().Z - DEFAULT_EYE_HEIGHT
-		));
-		FirstPersonCameraComponent->SetRelativeLocation(FVector(0.0f, 0.0f, DEFAULT_EYE_HEIGHT));
-	}
+	// Takeoff & Landing Happen in the Next Predicted Move
+	SandboxMovementComponent->SetWantsToFly(!SandboxMovementComponent->GetWantsToFly());
 }
\ No newline at end of file
@@ -10,6 +10,7 @@ class UCapsuleComponent;
 class UControllerDiagnosticWidget;
 class UGamepadLookAdapter;
 class UGrabComponent;
+class USandboxCharacterMovementComponent;
 
 /*
  *  FirstPersonCharacter.h                          Chris Cruzen
@@ -43,9 +44,6 @@ class AFirstPersonCharacter : public AInputCharacter {
 	public: UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Gameplay)
 	bool IsFlyingEnabled = true;
 
-	public: UPROPERTY()
-	bool IsFlying;
-
 	public: UPROPERTY(EditAnywhere, BlueprintReadWrite, Category=Gameplay)
 	bool IsGrabEnabled = true;
 
@@ -55,30 +53,33 @@ class AFirstPersonCharacter : public AInputCharacter {
 	protected: UPROPERTY()
 	UGamepadLookAdapter* GamepadLookAdapter;
 
+	protected: UPROPERTY()
+	USandboxCharacterMovementComponent* SandboxMovementComponent;
+
 	protected: UPROPERTY(VisibleAnywhere, BlueprintReadOnly, meta = (AllowPrivateAccess = "true"))
 	UGrabComponent* GrabComponent;
 
 	public: UPROPERTY()
 	AFirstPersonHUD* FirstPersonHUD;
 
-	private: float VerticalForceUp = 0.0f;
-	private: float VerticalForceDown = 0.0f;
-
 
 	/*--- Lifecycle Functions ---*/
 
-	public: AFirstPersonCharacter();
+	public: AFirstPersonCharacter(const FObjectInitializer& ObjectInitializer);
 
 	protected: virtual void BeginPlay() override;
-	protected: virtual void Tick(float DeltaSeconds) override;
+
+	// APawn Override
+	public: virtual void NotifyControllerChanged() override;
+
+	// ACharacter Override
+	public: virtual void OnMovementModeChanged(EMovementMode PrevMovementMode, uint8 PreviousCustomMode = 0) override;
 
 
 	/*--- First Person Setup Functions ---*/
 
 	protected: void SetupGamepadLookAdapter();
 
-	protected: void SetupGrabComponent();
-
 	protected: void SetupFirstPersonHUD();
 
 
@@ -108,4 +109,9 @@ class AFirstPersonCharacter : public AInputCharacter {
 
 	virtual void OnDPadUpPress() override;
 
+
+	/*--- Movement Functions ---*/
+
+	public: bool IsFlying() const;
+
 };
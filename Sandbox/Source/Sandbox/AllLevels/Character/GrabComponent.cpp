@@ -1,16 +1,34 @@
 #include "GrabComponent.h"
 #include "DrawDebugHelpers.h"
 #include "GameFramework/Actor.h"
-#include "GameFramework/PlayerController.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/Pawn.h"
 #include "GrabbableComponent.h"
+#include "GrabTraceSubsystem.h"
+#include "Net/UnrealNetwork.h"
+#include "PhysicsHandlePoolSubsystem.h"
 #include "Engine/World.h"
+#include "AllLevels/Utility/SandboxLog.h"
+#include "AllLevels/Utility/SandboxMemory.h"
+#include "AllLevels/Utility/SandboxStats.h"
 
 /*
  *  GrabberComponent.cpp                               Chris Cruzen
  *  Sandbox                                              02.12.2023
  *
  *    GrabberComponent gives its actor the ability to grab and move
- *  other objects in the scene.
+ *  other objects in the scene. Physics handles are leased from the
+ *  world's PhysicsHandlePoolSubsystem, one per held object, and all
+ *  grab & focus traces are batched through GrabTraceSubsystem.
+ *
+ *  Networking
+ *    - The server owns every grab. Owning clients predict grabs and
+ *      releases locally, then confirm them via ServerGrabObject() &
+ *      ServerReleaseObject(). Rejected grabs are undone locally.
+ *    - Held object poses are replicated to everyone but the holder
+ *      as quantized offsets relative to the holder's view. Other
+ *      clients drive the object with their own physics handle,
+ *      smoothing toward each update.
  */
 
 
@@ -19,10 +37,50 @@
 #define OUT
 
 
+/*--- Replicated Held Object ---*/
+
+void FGrabReplicatedObject::SetViewOffset(const FVector& Location, const FRotator& Rotation) {
+	OffsetX = (int16) FMath::Clamp(FMath::RoundToInt(Location.X), (int32) MIN_int16, (int32) MAX_int16);
+	OffsetY = (int16) FMath::Clamp(FMath::RoundToInt(Location.Y), (int32) MIN_int16, (int32) MAX_int16);
+	OffsetZ = (int16) FMath::Clamp(FMath::RoundToInt(Location.Z), (int32) MIN_int16, (int32) MAX_int16);
+	Pitch = FRotator::CompressAxisToShort(Rotation.Pitch);
+	Yaw = FRotator::CompressAxisToShort(Rotation.Yaw);
+	Roll = FRotator::CompressAxisToShort(Rotation.Roll);
+}
+
+FVector FGrabReplicatedObject::GetViewLocationOffset() const {
+	return FVector(OffsetX, OffsetY, OffsetZ);
+}
+
+FRotator FGrabReplicatedObject::GetViewRotationOffset() const {
+	return FRotator(
+		FRotator::DecompressAxisFromShort(Pitch),
+		FRotator::DecompressAxisFromShort(Yaw),
+		FRotator::DecompressAxisFromShort(Roll)
+	);
+}
+
+bool FGrabReplicatedObject::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess) {
+	UObject* Object = PrimitiveComponent;
+	bOutSuccess = Map->SerializeObject(Ar, UPrimitiveComponent::StaticClass(), Object);
+	if (Ar.IsLoading()) {
+		PrimitiveComponent = Cast<UPrimitiveComponent>(Object);
+	}
+
+	Ar << OffsetX << OffsetY << OffsetZ;
+	Ar << Pitch << Yaw << Roll;
+	return true;
+}
+
+
 /*--- Lifecycle Functions ---*/
 
 UGrabComponent::UGrabComponent() {
 	PrimaryComponentTick.bCanEverTick = true;
+	SetIsReplicatedByDefault(true);
+
+	// Run After Cameras Update, So Hold Points Follow This Frame's View
+	PrimaryComponentTick.TickGroup = TG_PostUpdateWork;
 }
 
 void UGrabComponent::TickComponent(
@@ -31,127 +89,422 @@ void UGrabComponent::TickComponent(
 	FActorComponentTickFunction* ThisTickFunction
 ) {
 	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+	SANDBOX_SCOPE(Grab);
+	INC_DWORD_STAT_BY(STAT_SandboxHeldObjects, HeldObjects.Num());
+	LLM_SCOPE_BYTAG(Sandbox_Grab);
+
+	// Simulated Proxies Follow Replicated Held State
+	if (IsSimulatedHolder()) {
+		UpdateSimulatedHeldObjects(DeltaTime);
+		return;
+	}
 
 	UpdateGrabRaycast();
 
-	// If Object Grabbed, Update Location
-	if (PhysicsHandleComponent && PhysicsHandleComponent->GrabbedComponent) {
-		PhysicsHandleComponent->SetTargetLocation(HoldPoint);
+	// Record Hold Point for Throw Estimation
+	if (IsGrabbing()) {
+		HoldPointHistory.AddSample(GetWorld()->GetTimeSeconds(), HoldPoint, PlayerRotation);
+	}
+
+	// Refresh Focused Actor via Batched Trace
+	if (ShouldScanForFocus()) {
+		TimeSinceFocusScan += DeltaTime;
+		if (!IsFocusTracePending && TimeSinceFocusScan >= FocusScanInterval) {
+			TimeSinceFocusScan = 0.0f;
+			IsFocusTracePending = true;
+			QueueViewTrace(FGrabTraceDelegate::CreateUObject(this, &UGrabComponent::OnFocusTraceComplete));
+		}
+	}
+
+	// If Objects Grabbed, Update Locations
+	for (int32 Index = 0; Index < HeldObjects.Num(); Index++) {
+		UPhysicsHandleComponent* Handle = HeldObjects[Index].PhysicsHandleComponent;
+		if (Handle && Handle->GrabbedComponent) {
+			Handle->SetTargetLocation(GetHoldPointForIndex(Index));
+		}
+	}
+
+	// Server Sends Held State at a Reduced Rate
+	if (GetOwner()->HasAuthority() && HeldObjects.Num() > 0) {
+		TimeSinceHeldStateUpdate += DeltaTime;
+		if (TimeSinceHeldStateUpdate >= 1.0f / FMath::Max(HeldStateUpdateRate, 1.0f)) {
+			TimeSinceHeldStateUpdate = 0.0f;
+			UpdateReplicatedHeldObjects();
+		}
 	}
 }
 
 void UGrabComponent::BeginPlay() {
 	Super::BeginPlay();
+	LLM_SCOPE_BYTAG(Sandbox_Grab);
+
+	// Follow the Owner's Input & Movement for the Frame
+	if (GetOwner()) AddTickPrerequisiteActor(GetOwner());
 
 	InitializeMemberClasses();
 }
 
+void UGrabComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+	ReleaseAllHeldObjects(false);
 
-/*--- Behavior Functions ---*/
+	Super::EndPlay(EndPlayReason);
+}
 
-void UGrabComponent::GrabObject() {
-	AActor * RaycastHitActor = GetActorInView();
+void UGrabComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const {
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	// If Actor Found, Grab
-	if (RaycastHitActor && !IsGrabbing) {
-		ObjectPrimitiveComponent = Cast<UPrimitiveComponent>(
-			RaycastHitActor->GetComponentByClass(UPrimitiveComponent::StaticClass())
-		);
-		IsGrabbing = true;
+	// Holder Predicts Locally, So Only Other Clients Need Held State
+	DOREPLIFETIME_CONDITION(UGrabComponent, ReplicatedHeldObjects, COND_SkipOwner);
+}
 
-		// Grab Object
-		PhysicsHandleComponent->GrabComponentAtLocation(
-			ObjectPrimitiveComponent,
-			NAME_None,
-			RaycastHitActor->GetActorLocation()
-		);
 
-		// Increase Angular Damping to Avoid Uncontrolled Twirling
-		ObjectAngularDamping = ObjectPrimitiveComponent->GetAngularDamping();
-		ObjectPrimitiveComponent->SetAngularDamping(HoldAngularDamping);
+/*--- Behavior Functions ---*/
+
+bool UGrabComponent::GrabObject() {
+	if (IsGrabTracePending || HeldObjects.Num() >= MaxHeldObjects) return false;
+
+	// Trace From Freshest View; Grab Completes in OnGrabTraceComplete()
+	UpdateGrabRaycast();
+	IsGrabTracePending = true;
+	ShouldReleaseOnGrabMiss = false;
+	QueueViewTrace(FGrabTraceDelegate::CreateUObject(this, &UGrabComponent::OnGrabTraceComplete));
+	return true;
+}
+
+void UGrabComponent::GrabOrReleaseObject() {
+	if (HeldObjects.Num() >= MaxHeldObjects) {
+		ReleaseObject();
+		return;
 	}
+
+	// A Trace Already Pending Keeps Its Own Miss Behavior
+	if (GrabObject()) ShouldReleaseOnGrabMiss = true;
 }
 
 void UGrabComponent::ReleaseObject() {
-	if (IsGrabbing) {
-		IsGrabbing = false;
+	if (!IsGrabbing()) return;
+
+	ReleaseAllHeldObjects(true);
+
+	if (GetOwner()->HasAuthority()) {
+		UpdateReplicatedHeldObjects();
+	} else {
+		ServerReleaseObject();
+	}
+}
+
+bool UGrabComponent::IsGrabbing() const {
+	return HeldObjects.Num() > 0;
+}
 
-		// Release Object
-		PhysicsHandleComponent->ReleaseComponent();
+bool UGrabComponent::IsHoldingComponent(const UPrimitiveComponent* Component) const {
+	return HeldObjects.ContainsByPredicate([Component](const FGrabbedObject& HeldObject) {
+		return HeldObject.PrimitiveComponent == Component;
+	});
+}
 
-		// Restore Previous Angular Damping
-		ObjectPrimitiveComponent->SetAngularDamping(ObjectAngularDamping);
-	} 
+AActor* UGrabComponent::GetFocusedActor() const {
+	return FocusedActor.Get();
 }
 
 void UGrabComponent::InitializeMemberClasses() {
 
 	// Search Owning Actor for a Specific Component Type (Returns first found!)
-	PhysicsHandleComponent = GetOwner()->FindComponentByClass<UPhysicsHandleComponent>();
 	InputComponent = GetOwner()->FindComponentByClass<UInputComponent>();
-
-	// Null Check PhysicsHandleComponent
-	if (!PhysicsHandleComponent) {
-		UE_LOG(
-			LogTemp,
-			Error,
-			TEXT("No PhysicsHandleComponent found on Actor %s"),
-			*GetOwner()->GetName()
-		);
-	}
 }
 
 void UGrabComponent::UpdateGrabRaycast() {
 
-	// Update Player Location/Rotation
+	// Update Player Location/Rotation From Owner's View (Works for Any Controller)
 	PlayerLocation = FVector();
-	FRotator PlayerRotation = FRotator();
-	GetWorld()->GetFirstPlayerController()->GetPlayerViewPoint(
-		OUT PlayerLocation,
-		OUT PlayerRotation
-	);
+	PlayerRotation = FRotator();
+	APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	AController* OwnerController = OwnerPawn ? OwnerPawn->GetController() : nullptr;
+	if (OwnerController) {
+		OwnerController->GetPlayerViewPoint(OUT PlayerLocation, OUT PlayerRotation);
+	} else {
+		GetOwner()->GetActorEyesViewPoint(OUT PlayerLocation, OUT PlayerRotation);
+	}
 
-	// Update Raycast End Point 
+	// Update Raycast End Point
 	RaycastEndPoint = PlayerLocation + PlayerRotation.Vector() * PlayerReach;
 	HoldPoint = PlayerLocation + PlayerRotation.Vector() * HoldDistance;
 }
 
-AActor *UGrabComponent::GetActorInView() {
+bool UGrabComponent::GrabComponentLocally(UPrimitiveComponent* Component, const FVector& GrabLocation, bool ConstrainRotation) {
 
-	// Initialize Raycast Variables
-	FHitResult RaycastHit;
-	FCollisionQueryParams RaycastParams = FCollisionQueryParams(
-		FName(TEXT("")),
-		false, // Whether to use Visibility Collision
-		GetOwner()// Any Actor to ignore? (Player!)
-	);
+	// Lease Physics Handle
+	UPhysicsHandlePoolSubsystem* HandlePool = GetWorld()->GetSubsystem<UPhysicsHandlePoolSubsystem>();
+	UPhysicsHandleComponent* Handle = HandlePool ? HandlePool->LeaseHandle() : nullptr;
+	if (!Handle) return false;
 
-	// Perform Raycast
-	GetWorld()->LineTraceSingleByObjectType(
-		OUT RaycastHit,
-		PlayerLocation,
-		RaycastEndPoint,
-		FCollisionObjectQueryParams(ECollisionChannel::ECC_PhysicsBody),
-		RaycastParams
-	);
+	// Grab Object
+	if (ConstrainRotation) {
+		Handle->GrabComponentAtLocationWithRotation(Component, NAME_None, GrabLocation, Component->GetComponentRotation());
+	} else {
+		Handle->GrabComponentAtLocation(Component, NAME_None, GrabLocation);
+	}
 
-	// Determine if Actor Returned
-	if (RaycastHit.GetActor()) {
+	// Start Fresh Throw History
+	if (!IsGrabbing()) HoldPointHistory.Reset();
 
-		// Determine if Actor Has GravityComponent
-		UActorComponent *Component = RaycastHit.GetActor()->FindComponentByClass(UGrabbableComponent::StaticClass());
-		if (Component) {
+	// Increase Angular Damping to Avoid Uncontrolled Twirling
+	FGrabbedObject GrabbedObject;
+	GrabbedObject.PrimitiveComponent = Component;
+	GrabbedObject.PhysicsHandleComponent = Handle;
+	GrabbedObject.SavedAngularDamping = Component->GetAngularDamping();
+	Component->SetAngularDamping(HoldAngularDamping);
+	HeldObjects.Add(GrabbedObject);
 
-			// Determine if Grabbing Enabled
-			UGrabbableComponent *GrabbableComponent = Cast<UGrabbableComponent>(Component);
-			if (GrabbableComponent && GrabbableComponent->Grabbable) {
+	// Notify Grabbable
+	UGrabbableComponent* GrabbableComponent = Component->GetOwner()->FindComponentByClass<UGrabbableComponent>();
+	if (GrabbableComponent) GrabbableComponent->NotifyGrabbed();
 
-				// Return Actor
-				return RaycastHit.GetActor();
-			}
+	SANDBOX_LOG(Grab, "{0} grabbed {1} ({2} held)", GetOwner()->GetFName(), Component->GetOwner()->GetFName(), HeldObjects.Num());
+	return true;
+}
+
+void UGrabComponent::ReleaseComponentLocally(UPrimitiveComponent* Component) {
+	int32 Index = HeldObjects.IndexOfByPredicate([Component](const FGrabbedObject& HeldObject) {
+		return HeldObject.PrimitiveComponent == Component;
+	});
+	if (Index != INDEX_NONE) ReleaseHeldObject(Index);
+}
+
+void UGrabComponent::ReleaseHeldObject(int32 Index) {
+	FGrabbedObject GrabbedObject = HeldObjects[Index];
+	HeldObjects.RemoveAt(Index);
+
+	// Return Physics Handle (Releases Object)
+	UPhysicsHandlePoolSubsystem* HandlePool = GetWorld() ? GetWorld()->GetSubsystem<UPhysicsHandlePoolSubsystem>() : nullptr;
+	if (HandlePool) {
+		HandlePool->ReturnHandle(GrabbedObject.PhysicsHandleComponent);
+	} else if (GrabbedObject.PhysicsHandleComponent) {
+		GrabbedObject.PhysicsHandleComponent->ReleaseComponent();
+	}
+
+	// Restore Previous Angular Damping & Notify Grabbable
+	if (GrabbedObject.PrimitiveComponent) {
+		GrabbedObject.PrimitiveComponent->SetAngularDamping(GrabbedObject.SavedAngularDamping);
+
+		AActor* ObjectOwner = GrabbedObject.PrimitiveComponent->GetOwner();
+		UGrabbableComponent* GrabbableComponent = ObjectOwner ? ObjectOwner->FindComponentByClass<UGrabbableComponent>() : nullptr;
+		if (GrabbableComponent) GrabbableComponent->NotifyReleased();
+	}
+}
+
+void UGrabComponent::ReleaseAllHeldObjects(bool ShouldThrow) {
+
+	// Estimate Throw From Recent Hold Point Motion
+	FVector ThrowVelocity;
+	FVector ThrowAngularVelocity;
+	ShouldThrow = ShouldThrow && HoldPointHistory.EstimateVelocity(ThrowEstimationWindow, ThrowVelocity, ThrowAngularVelocity);
+	ThrowVelocity = ThrowVelocity.GetClampedToMaxSize(MaxThrowSpeed);
+	SANDBOX_LOG(Grab, "{0} released {1} objects, thrown {2} at {3} cm/s", GetOwner()->GetFName(), HeldObjects.Num(), ShouldThrow, ShouldThrow ? ThrowVelocity.Size() : 0.0);
+
+	for (int32 Index = HeldObjects.Num() - 1; Index >= 0; Index--) {
+		UPrimitiveComponent* Component = HeldObjects[Index].PrimitiveComponent;
+		ReleaseHeldObject(Index);
+
+		// Override Whatever Velocity the Constraint Left Behind
+		if (ShouldThrow && Component && Component->IsSimulatingPhysics()) {
+			Component->SetPhysicsLinearVelocity(ThrowVelocity);
+			Component->SetPhysicsAngularVelocityInDegrees(ThrowAngularVelocity * ThrowAngularScale);
 		}
 	}
 
-	// No Actor Found
-	return nullptr;
-}
\ No newline at end of file
+	HoldPointHistory.Reset();
+}
+
+FVector UGrabComponent::GetHoldPointForIndex(int32 Index) const {
+
+	// Stack Additional Objects Above the Primary Hold Point
+	return HoldPoint + FRotationMatrix(PlayerRotation).GetUnitAxis(EAxis::Z) * HeldObjectSpacing * Index;
+}
+
+bool UGrabComponent::IsGrabbableActor(AActor* Actor) const {
+	if (!Actor) return false;
+
+	// Determine if Actor Has GrabbableComponent & Grabbing Enabled
+	UGrabbableComponent *GrabbableComponent = Actor->FindComponentByClass<UGrabbableComponent>();
+	return GrabbableComponent && GrabbableComponent->Grabbable;
+}
+
+bool UGrabComponent::TryGrabActor(AActor* Actor) {
+
+	// Only Grab if Grabbable Actor Found & Slot Free
+	if (!IsGrabbableActor(Actor) || HeldObjects.Num() >= MaxHeldObjects) return false;
+
+	UPrimitiveComponent* ObjectPrimitiveComponent = Actor->FindComponentByClass<UGrabbableComponent>()->GetPrimitiveComponent();
+	if (!ObjectPrimitiveComponent || IsHoldingComponent(ObjectPrimitiveComponent)) return false;
+
+	// Grab Locally (Authoritative on Server, Predicted on Clients)
+	if (!GrabComponentLocally(ObjectPrimitiveComponent, Actor->GetActorLocation(), false)) return false;
+
+	if (GetOwner()->HasAuthority()) {
+		UpdateReplicatedHeldObjects();
+	} else {
+		ServerGrabObject(ObjectPrimitiveComponent);
+	}
+
+	return true;
+}
+
+bool UGrabComponent::ShouldScanForFocus() const {
+
+	// Only Locally Controlled Grabbers Need to Know What They're Looking At
+	APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	return ScanForFocus && OwnerPawn && OwnerPawn->IsLocallyControlled();
+}
+
+
+/*--- Trace Functions ---*/
+
+void UGrabComponent::QueueViewTrace(FGrabTraceDelegate Callback) {
+	UGrabTraceSubsystem* TraceSubsystem = GetWorld()->GetSubsystem<UGrabTraceSubsystem>();
+	if (TraceSubsystem) {
+		TraceSubsystem->QueueTrace(PlayerLocation, RaycastEndPoint, GetOwner(), MoveTemp(Callback));
+	}
+}
+
+void UGrabComponent::OnGrabTraceComplete(const FHitResult& RaycastHit) {
+	SANDBOX_SCOPE(Grab);
+	LLM_SCOPE_BYTAG(Sandbox_Grab);
+	IsGrabTracePending = false;
+
+	if (!TryGrabActor(RaycastHit.GetActor()) && ShouldReleaseOnGrabMiss) {
+		ReleaseObject();
+	}
+	ShouldReleaseOnGrabMiss = false;
+}
+
+void UGrabComponent::OnFocusTraceComplete(const FHitResult& RaycastHit) {
+	SANDBOX_SCOPE(Grab);
+	LLM_SCOPE_BYTAG(Sandbox_Grab);
+	IsFocusTracePending = false;
+	FocusedActor = IsGrabbableActor(RaycastHit.GetActor()) ? RaycastHit.GetActor() : nullptr;
+}
+
+
+/*--- Network Functions ---*/
+
+void UGrabComponent::ServerGrabObject_Implementation(UPrimitiveComponent* Component) {
+	LLM_SCOPE_BYTAG(Sandbox_Grab);
+
+	UpdateGrabRaycast();
+
+	if (CanServerGrabComponent(Component) && GrabComponentLocally(Component, Component->GetOwner()->GetActorLocation(), false)) {
+		UpdateReplicatedHeldObjects();
+	} else {
+		ClientRejectGrab(Component);
+	}
+}
+
+void UGrabComponent::ServerReleaseObject_Implementation() {
+	ReleaseAllHeldObjects(true);
+
+	UpdateReplicatedHeldObjects();
+}
+
+void UGrabComponent::ClientRejectGrab_Implementation(UPrimitiveComponent* Component) {
+	SANDBOX_LOG(Grab, "{0} grab rejected by server", GetOwner()->GetFName());
+	ReleaseComponentLocally(Component);
+}
+
+void UGrabComponent::OnRep_ReplicatedHeldObjects() {
+	LLM_SCOPE_BYTAG(Sandbox_Grab);
+	if (!IsSimulatedHolder()) return;
+
+	// Release Objects No Longer Held
+	for (int32 Index = HeldObjects.Num() - 1; Index >= 0; Index--) {
+		UPrimitiveComponent* Component = HeldObjects[Index].PrimitiveComponent;
+		bool IsStillHeld = ReplicatedHeldObjects.ContainsByPredicate([Component](const FGrabReplicatedObject& ReplicatedObject) {
+			return ReplicatedObject.PrimitiveComponent == Component;
+		});
+		if (!IsStillHeld) ReleaseHeldObject(Index);
+	}
+
+	// Grab Newly Held Objects, Starting From Their Replicated Pose
+	for (const FGrabReplicatedObject& ReplicatedObject : ReplicatedHeldObjects) {
+		UPrimitiveComponent* Component = ReplicatedObject.PrimitiveComponent;
+		if (!Component || IsHoldingComponent(Component)) continue;
+
+		if (GrabComponentLocally(Component, Component->GetComponentLocation(), true)) {
+			HeldObjects.Last().SmoothedViewOffset = ReplicatedObject.GetViewLocationOffset();
+			HeldObjects.Last().SmoothedViewRotationOffset = ReplicatedObject.GetViewRotationOffset().Quaternion();
+		}
+	}
+}
+
+bool UGrabComponent::CanServerGrabComponent(UPrimitiveComponent* Component) const {
+	if (!Component || HeldObjects.Num() >= MaxHeldObjects || IsHoldingComponent(Component)) return false;
+	if (!IsGrabbableActor(Component->GetOwner())) return false;
+
+	// Allow for Latency & Object Size When Validating Reach
+	float MaxDistance = PlayerReach + Component->Bounds.SphereRadius + SERVER_REACH_TOLERANCE;
+	return FVector::Dist(PlayerLocation, Component->GetComponentLocation()) <= MaxDistance;
+}
+
+void UGrabComponent::UpdateReplicatedHeldObjects() {
+	FTransform ViewTransform = GetHolderViewTransform();
+
+	// Note: Unchanged entries quantize identically and aren't resent.
+	ReplicatedHeldObjects.Reset(HeldObjects.Num());
+	for (const FGrabbedObject& HeldObject : HeldObjects) {
+		if (!HeldObject.PrimitiveComponent) continue;
+
+		FGrabReplicatedObject ReplicatedObject;
+		ReplicatedObject.PrimitiveComponent = HeldObject.PrimitiveComponent;
+		ReplicatedObject.SetViewOffset(
+			ViewTransform.InverseTransformPosition(HeldObject.PrimitiveComponent->GetComponentLocation()),
+			ViewTransform.InverseTransformRotation(HeldObject.PrimitiveComponent->GetComponentQuat()).Rotator()
+		);
+		ReplicatedHeldObjects.Add(ReplicatedObject);
+	}
+}
+
+void UGrabComponent::UpdateSimulatedHeldObjects(float DeltaTime) {
+	FTransform ViewTransform = GetHolderViewTransform();
+
+	for (FGrabbedObject& HeldObject : HeldObjects) {
+		UPrimitiveComponent* Component = HeldObject.PrimitiveComponent;
+		const FGrabReplicatedObject* ReplicatedObject = ReplicatedHeldObjects.FindByPredicate([Component](const FGrabReplicatedObject& Candidate) {
+			return Candidate.PrimitiveComponent == Component;
+		});
+		if (!ReplicatedObject || !HeldObject.PhysicsHandleComponent) continue;
+
+		// Smooth Toward Latest Server Pose
+		HeldObject.SmoothedViewOffset = FMath::VInterpTo(
+			HeldObject.SmoothedViewOffset,
+			ReplicatedObject->GetViewLocationOffset(),
+			DeltaTime,
+			SimulatedSmoothingSpeed
+		);
+		HeldObject.SmoothedViewRotationOffset = FMath::QInterpTo(
+			HeldObject.SmoothedViewRotationOffset,
+			ReplicatedObject->GetViewRotationOffset().Quaternion(),
+			DeltaTime,
+			SimulatedSmoothingSpeed
+		);
+
+		HeldObject.PhysicsHandleComponent->SetTargetLocationAndRotation(
+			ViewTransform.TransformPosition(HeldObject.SmoothedViewOffset),
+			ViewTransform.TransformRotation(HeldObject.SmoothedViewRotationOffset).Rotator()
+		);
+	}
+}
+
+FTransform UGrabComponent::GetHolderViewTransform() const {
+
+	// Note: Base aim rotation & pawn view location are available on every machine.
+	APawn* OwnerPawn = Cast<APawn>(GetOwner());
+	if (OwnerPawn) {
+		return FTransform(OwnerPawn->GetBaseAimRotation(), OwnerPawn->GetPawnViewLocation());
+	}
+
+	return GetOwner()->GetActorTransform();
+}
+
+bool UGrabComponent::IsSimulatedHolder() const {
+	return GetOwnerRole() == ROLE_SimulatedProxy;
+}
@@ -5,6 +5,8 @@
 #include "Components/InputComponent.h"
 #include "Components/PrimitiveComponent.h"
 #include "PhysicsEngine/PhysicsHandleComponent.h"
+#include "GrabTraceSubsystem.h"
+#include "HoldPointHistory.h"
 #include "GrabComponent.generated.h"
 
 /*
@@ -12,26 +14,109 @@
  *  Sandbox                                              09.22.2022
  */
 
+USTRUCT()
+struct FGrabbedObject {
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UPrimitiveComponent* PrimitiveComponent = nullptr;
+
+	UPROPERTY()
+	UPhysicsHandleComponent* PhysicsHandleComponent = nullptr;
+
+	float SavedAngularDamping = 0.0f;
+
+	// Simulated Proxies Only - Smoothed Pose Relative to the Holder's View
+	FVector SmoothedViewOffset = FVector::ZeroVector;
+	FQuat SmoothedViewRotationOffset = FQuat::Identity;
+};
+
+/* Note: Held object pose is replicated relative to the holder's view, quantized
+ *       to whole centimeters and 16 bit rotation axes. Around 12 bytes plus an
+ *       object reference per held object, sent only at HeldStateUpdateRate.
+ */
+
+USTRUCT()
+struct FGrabReplicatedObject {
+	GENERATED_BODY()
+
+	UPROPERTY()
+	UPrimitiveComponent* PrimitiveComponent = nullptr;
+
+	UPROPERTY()
+	int16 OffsetX = 0;
+
+	UPROPERTY()
+	int16 OffsetY = 0;
+
+	UPROPERTY()
+	int16 OffsetZ = 0;
+
+	UPROPERTY()
+	uint16 Pitch = 0;
+
+	UPROPERTY()
+	uint16 Yaw = 0;
+
+	UPROPERTY()
+	uint16 Roll = 0;
+
+	void SetViewOffset(const FVector& Location, const FRotator& Rotation);
+
+	FVector GetViewLocationOffset() const;
+
+	FRotator GetViewRotationOffset() const;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGrabReplicatedObject> : public TStructOpsTypeTraitsBase2<FGrabReplicatedObject> {
+	enum { WithNetSerializer = true };
+};
+
 UCLASS( ClassGroup=(Custom), meta=(BlueprintSpawnableComponent) )
 class UGrabComponent : public UActorComponent {
 	GENERATED_BODY()
 
 
+	/*--- Constants ---*/
+
+	private: const float SERVER_REACH_TOLERANCE = 100.0f;
+
+
 	/*--- Variables ---*/
 
 	public: UPROPERTY(EditAnywhere) float PlayerReach = 300.f;
 	public: UPROPERTY(EditAnywhere) float HoldDistance = 170.f;
 	public: UPROPERTY(EditAnywhere) float HoldAngularDamping = 7.0f;
-	public: bool IsGrabbing = false;
+	public: UPROPERTY(EditAnywhere) int32 MaxHeldObjects = 1;
+	public: UPROPERTY(EditAnywhere) float HeldObjectSpacing = 60.f;
+	public: UPROPERTY(EditAnywhere) bool ScanForFocus = true;
+	public: UPROPERTY(EditAnywhere) float FocusScanInterval = 0.1f;
+	public: UPROPERTY(EditAnywhere, Category=Throwing) float ThrowEstimationWindow = 0.1f;
+	public: UPROPERTY(EditAnywhere, Category=Throwing) float MaxThrowSpeed = 3000.f;
+	public: UPROPERTY(EditAnywhere, Category=Throwing) float ThrowAngularScale = 1.0f;
+	public: UPROPERTY(EditAnywhere, Category=Replication) float HeldStateUpdateRate = 10.0f;
+	public: UPROPERTY(EditAnywhere, Category=Replication) float SimulatedSmoothingSpeed = 12.0f;
 
-	private: UPhysicsHandleComponent *PhysicsHandleComponent = nullptr;
 	private: UInputComponent *InputComponent = nullptr;
 	private: FVector PlayerLocation;
+	private: FRotator PlayerRotation;
 	private: FVector RaycastEndPoint;
 	private: FVector HoldPoint;
+	private: float TimeSinceHeldStateUpdate = 0.0f;
+	private: float TimeSinceFocusScan = 0.0f;
+	private: bool IsGrabTracePending = false;
+	private: bool IsFocusTracePending = false;
+	private: bool ShouldReleaseOnGrabMiss = false;
+	private: TWeakObjectPtr<AActor> FocusedActor;
+	private: FHoldPointHistory HoldPointHistory;
 
-	private: UPrimitiveComponent * ObjectPrimitiveComponent;
-	private: float ObjectAngularDamping;
+	private: UPROPERTY() TArray<FGrabbedObject> HeldObjects;
+
+	private: UPROPERTY(ReplicatedUsing=OnRep_ReplicatedHeldObjects)
+	TArray<FGrabReplicatedObject> ReplicatedHeldObjects;
 
 
 	/*--- Lifecycle Functions ---*/
@@ -46,14 +131,74 @@ class UGrabComponent : public UActorComponent {
 
 	protected: virtual void BeginPlay() override;
 
+	protected: virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	public: virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+
 
 	/*--- Behavior Functions ---*/
 
-	public: void GrabObject();
+	/** Queues a grab of the object in view. The grab happens once the batched trace returns,
+	 *  provided a hold slot is free. On clients the grab is predicted locally and confirmed or
+	 *  rejected by the server. Returns whether a trace was queued (Not While One Is Pending or Every
+	 *  Slot Is Full).
+	 */
+	public: bool GrabObject();
+
+	/** Grabs the object in view, or releases everything if nothing can be grabbed. **/
+	public: void GrabOrReleaseObject();
+
+	/** Releases every held object. **/
 	public: void ReleaseObject();
-			
+
+	public: bool IsGrabbing() const;
+
+	public: bool IsHoldingComponent(const UPrimitiveComponent* Component) const;
+
+	/** Grabbable actor currently under the player's view, refreshed every FocusScanInterval. **/
+	public: AActor* GetFocusedActor() const;
+
 	private: void InitializeMemberClasses();
 	private: void UpdateGrabRaycast();
-	private: AActor *GetActorInView();
+	private: bool GrabComponentLocally(UPrimitiveComponent* Component, const FVector& GrabLocation, bool ConstrainRotation);
+	private: void ReleaseComponentLocally(UPrimitiveComponent* Component);
+	private: void ReleaseHeldObject(int32 Index);
+	private: void ReleaseAllHeldObjects(bool ShouldThrow);
+	private: FVector GetHoldPointForIndex(int32 Index) const;
+	private: bool IsGrabbableActor(AActor* Actor) const;
+	private: bool TryGrabActor(AActor* Actor);
+	private: bool ShouldScanForFocus() const;
+
+
+	/*--- Trace Functions ---*/
+
+	private: void QueueViewTrace(FGrabTraceDelegate Callback);
+	private: void OnGrabTraceComplete(const FHitResult& RaycastHit);
+	private: void OnFocusTraceComplete(const FHitResult& RaycastHit);
+
+
+	/*--- Network Functions ---*/
+
+	private: UFUNCTION(Server, Reliable)
+	void ServerGrabObject(UPrimitiveComponent* Component);
+
+	private: UFUNCTION(Server, Reliable)
+	void ServerReleaseObject();
+
+	private: UFUNCTION(Client, Reliable)
+	void ClientRejectGrab(UPrimitiveComponent* Component);
+
+	private: UFUNCTION()
+	void OnRep_ReplicatedHeldObjects();
+
+	private: bool CanServerGrabComponent(UPrimitiveComponent* Component) const;
+
+	private: void UpdateReplicatedHeldObjects();
+
+	private: void UpdateSimulatedHeldObjects(float DeltaTime);
+
+	private: FTransform GetHolderViewTransform() const;
+
+	private: bool IsSimulatedHolder() const;
 
 };
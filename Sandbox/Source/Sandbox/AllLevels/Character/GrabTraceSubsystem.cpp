@@ -0,0 +1,96 @@
+
+#include "GrabTraceSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "AllLevels/Utility/SandboxMemory.h"
+#include "AllLevels/Utility/SandboxStats.h"
+
+/*
+ *  GrabTraceSubsystem.cpp                            Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    GrabTraceSubsystem collects grab and focus traces from every
+ *  GrabComponent in the world and runs them as a single batch each
+ *  frame. The batch is spread across worker threads, so scene query
+ *  setup is shared and trace cost stays off the game thread as the
+ *  number of players grows.
+ *
+ *  Note: Tickable world subsystems tick once per frame after
+ *        TG_PostPhysics and the world's timers, but before
+ *        TG_PostUpdateWork and TG_LastDemotable. GrabComponent queues
+ *        in TG_PostUpdateWork, so its traces run in the next frame's
+ *        batch, against that frame's post-physics state, and their
+ *        results arrive one frame after they were queued.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+void UGrabTraceSubsystem::Tick(float DeltaTime) {
+	if (PendingRequests.Num() > 0) {
+		RunTraceBatch();
+	}
+}
+
+TStatId UGrabTraceSubsystem::GetStatId() const {
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGrabTraceSubsystem, STATGROUP_Tickables);
+}
+
+bool UGrabTraceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const {
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+/*--- Trace Functions ---*/
+
+void UGrabTraceSubsystem::QueueTrace(
+	const FVector& Start,
+	const FVector& End,
+	const AActor* IgnoredActor,
+	FGrabTraceDelegate Callback
+) {
+	LLM_SCOPE_BYTAG(Sandbox_Grab);
+
+	FGrabTraceRequest& Request = PendingRequests.AddDefaulted_GetRef();
+	Request.Start = Start;
+	Request.End = End;
+	Request.IgnoredActor = IgnoredActor;
+	Request.Callback = MoveTemp(Callback);
+}
+
+void UGrabTraceSubsystem::RunTraceBatch() {
+	SANDBOX_SCOPE(GrabTrace);
+	LLM_SCOPE_BYTAG(Sandbox_Grab);
+	INC_DWORD_STAT_BY(STAT_SandboxGrabTraces, PendingRequests.Num());
+
+	// Swap Queues (Callbacks May Queue Next Frame's Traces)
+	Swap(PendingRequests, ProcessingRequests);
+	PendingRequests.Reset();
+	ProcessingResults.Reset();
+	ProcessingResults.SetNum(ProcessingRequests.Num());
+
+	// Run Traces Across Worker Threads
+	UWorld* World = GetWorld();
+	const FCollisionObjectQueryParams ObjectParams(ECollisionChannel::ECC_PhysicsBody);
+	ParallelFor(
+		ProcessingRequests.Num(),
+		[this, World, &ObjectParams](int32 Index) {
+			const FGrabTraceRequest& Request = ProcessingRequests[Index];
+			FCollisionQueryParams QueryParams(
+				SCENE_QUERY_STAT(GrabTrace),
+				false, // Whether to use Visibility Collision
+				Request.IgnoredActor.Get()
+			);
+			World->LineTraceSingleByObjectType(ProcessingResults[Index], Request.Start, Request.End, ObjectParams, QueryParams);
+		},
+		ProcessingRequests.Num() < MIN_TRACES_PER_WORKER ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None
+	);
+
+	// Deliver Results on Game Thread
+	TRACE_CPUPROFILER_EVENT_SCOPE(UGrabTraceSubsystem::DeliverResults);
+	for (int32 Index = 0; Index < ProcessingRequests.Num(); Index++) {
+		ProcessingRequests[Index].Callback.ExecuteIfBound(ProcessingResults[Index]);
+	}
+
+	ProcessingRequests.Reset();
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "GrabTraceSubsystem.generated.h"
+
+/*
+ *  GrabTraceSubsystem.h                              Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for GrabTraceSubsystem.cpp.
+ */
+
+// Receives the result of a queued grab or focus trace (on the game thread).
+DECLARE_DELEGATE_OneParam(FGrabTraceDelegate, const FHitResult&);
+
+struct FGrabTraceRequest {
+	FVector Start = FVector::ZeroVector;
+	FVector End = FVector::ZeroVector;
+	TWeakObjectPtr<const AActor> IgnoredActor;
+	FGrabTraceDelegate Callback;
+};
+
+UCLASS()
+class SANDBOX_API UGrabTraceSubsystem : public UTickableWorldSubsystem {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	// Below this many traces, worker dispatch costs more than it saves.
+	private: const int32 MIN_TRACES_PER_WORKER = 4;
+
+
+	/*--- Variables ---*/
+
+	private: TArray<FGrabTraceRequest> PendingRequests;
+	private: TArray<FGrabTraceRequest> ProcessingRequests;
+	private: TArray<FHitResult> ProcessingResults;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: virtual void Tick(float DeltaTime) override;
+
+	public: virtual TStatId GetStatId() const override;
+
+	protected: virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+
+	/*--- Trace Functions ---*/
+
+	/** Queues a physics body line trace. Queued traces run together as one parallel batch on the
+	 *  subsystem's next tick (Before TG_PostUpdateWork), then each callback is invoked on the game thread.
+	 */
+	public: void QueueTrace(
+		const FVector& Start,
+		const FVector& End,
+		const AActor* IgnoredActor,
+		FGrabTraceDelegate Callback
+	);
+
+	private: void RunTraceBatch();
+
+};
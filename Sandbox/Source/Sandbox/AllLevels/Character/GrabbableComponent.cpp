@@ -1,24 +1,122 @@
-
 #include "GrabbableComponent.h"
 #include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
 #include "GameFramework/Actor.h"
+#include "TimerManager.h"
 
 /*
  *  GrabbableComponent.cpp                              Chris Cruzen
  *  Sandbox                                               09.22.2022
  *
  *    GrabbableComponent implements grab behavior for the actors its
- *  attached to.
+ *  attached to. While held, the server stops replicating the owner's
+ *  movement; clients follow the holder's replicated grab state until
+ *  the object is released.
+ *
+ *    The component never ticks. Props wake when grabbed (or when
+ *  physics wakes them on contact), and after release a short timer
+ *  puts them back to sleep once they've settled. Props placed at
+ *  rest can opt into starting asleep with StartAsleep.
  */
 
 
 /*--- Lifecycle Functions ---*/
 
 UGrabbableComponent::UGrabbableComponent() {
-	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UGrabbableComponent::BeginPlay() {
 	Super::BeginPlay();
+
+	// Cache Primitive (Prefer Root)
+	ObjectPrimitiveComponent = Cast<UPrimitiveComponent>(GetOwner()->GetRootComponent());
+	if (!ObjectPrimitiveComponent) {
+		ObjectPrimitiveComponent = GetOwner()->FindComponentByClass<UPrimitiveComponent>();
+	}
+
+	// Avoid Simulating Idle Props
+	if (StartAsleep && ObjectPrimitiveComponent && ObjectPrimitiveComponent->IsSimulatingPhysics()) {
+		ObjectPrimitiveComponent->PutRigidBodyToSleep();
+	}
+}
+
+void UGrabbableComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+	StopSettleCheck();
+
+	Super::EndPlay(EndPlayReason);
 }
 
+
+/*--- Grab Notification Functions ---*/
+
+void UGrabbableComponent::NotifyGrabbed() {
+	HolderCount++;
+	StopSettleCheck();
+
+	if (ObjectPrimitiveComponent) {
+		ObjectPrimitiveComponent->WakeRigidBody();
+	}
+
+	// Pause Movement Replication While Held (Server Only)
+	AActor* Owner = GetOwner();
+	if (HolderCount == 1 && Owner->HasAuthority() && Owner->GetIsReplicated() && Owner->IsReplicatingMovement()) {
+		ShouldRestoreReplicateMovement = true;
+		Owner->SetReplicateMovement(false);
+	}
+}
+
+void UGrabbableComponent::NotifyReleased() {
+	HolderCount = FMath::Max(HolderCount - 1, 0);
+	if (HolderCount > 0) return;
+
+	// Resume Movement Replication So Final Resting State Syncs
+	if (ShouldRestoreReplicateMovement) {
+		ShouldRestoreReplicateMovement = false;
+		GetOwner()->SetReplicateMovement(true);
+	}
+
+	// Watch for Settle at a Low Rate
+	if (SleepWhenSettled && ObjectPrimitiveComponent && GetWorld()) {
+		SettledDuration = 0.0f;
+		GetWorld()->GetTimerManager().SetTimer(
+			SettleTimerHandle,
+			this,
+			&UGrabbableComponent::CheckSettled,
+			SettleCheckInterval,
+			true
+		);
+	}
+}
+
+UPrimitiveComponent* UGrabbableComponent::GetPrimitiveComponent() const {
+	return ObjectPrimitiveComponent;
+}
+
+
+/*--- Sleep Functions ---*/
+
+void UGrabbableComponent::CheckSettled() {
+
+	// Physics Already Slept the Body, or Someone Grabbed It
+	if (!ObjectPrimitiveComponent || HolderCount > 0 || !ObjectPrimitiveComponent->IsAnyRigidBodyAwake()) {
+		StopSettleCheck();
+		return;
+	}
+
+	bool IsSlow = ObjectPrimitiveComponent->GetPhysicsLinearVelocity().Size() <= SettleLinearSpeed
+		&& ObjectPrimitiveComponent->GetPhysicsAngularVelocityInDegrees().Size() <= SettleAngularSpeed;
+	SettledDuration = IsSlow ? SettledDuration + SettleCheckInterval : 0.0f;
+
+	if (SettledDuration >= SettleTime) {
+		ObjectPrimitiveComponent->PutRigidBodyToSleep();
+		StopSettleCheck();
+	}
+}
+
+void UGrabbableComponent::StopSettleCheck() {
+	if (GetWorld()) {
+		GetWorld()->GetTimerManager().ClearTimer(SettleTimerHandle);
+	}
+	SettledDuration = 0.0f;
+}
@@ -4,6 +4,8 @@
 #include "Components/ActorComponent.h"
 #include "GrabbableComponent.generated.h"
 
+class UPrimitiveComponent;
+
 /*
  *  GrabbableComponent.h                                Chris Cruzen
  *  Sandbox                                               09.22.2022
@@ -17,10 +19,54 @@ public:
 	UPROPERTY(EditAnywhere)
 	bool Grabbable = true;
 
+	/** Sleeps the prop at BeginPlay. Only for props placed at rest, anything mid-air or in an unsettled stack freezes until touched. **/
+	UPROPERTY(EditAnywhere, Category=Sleep)
+	bool StartAsleep = false;
+
+	UPROPERTY(EditAnywhere, Category=Sleep)
+	bool SleepWhenSettled = true;
+
+	UPROPERTY(EditAnywhere, Category=Sleep)
+	float SettleLinearSpeed = 5.0f;
+
+	UPROPERTY(EditAnywhere, Category=Sleep)
+	float SettleAngularSpeed = 5.0f;
+
+	UPROPERTY(EditAnywhere, Category=Sleep)
+	float SettleTime = 0.5f;
+
+	UPROPERTY(EditAnywhere, Category=Sleep)
+	float SettleCheckInterval = 0.25f;
+
+private:
+	UPROPERTY()
+	UPrimitiveComponent* ObjectPrimitiveComponent = nullptr;
+
+	int32 HolderCount = 0;
+	bool ShouldRestoreReplicateMovement = false;
+	float SettledDuration = 0.0f;
+	FTimerHandle SettleTimerHandle;
+
 public:
 	UGrabbableComponent();
 
+	/** Called by UGrabComponent whenever a grabber takes hold of the owning actor. **/
+	void NotifyGrabbed();
+
+	/** Called by UGrabComponent whenever a grabber lets go of the owning actor. **/
+	void NotifyReleased();
+
+	/** Primitive moved when the owning actor is grabbed, cached at BeginPlay. **/
+	UPrimitiveComponent* GetPrimitiveComponent() const;
+
 protected:
 	virtual void BeginPlay() override;
+
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+	void CheckSettled();
+
+	void StopSettleCheck();
 		
 };
@@ -0,0 +1,85 @@
+
+#include "HoldPointHistory.h"
+
+/*
+ *  HoldPointHistory.cpp                              Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    HoldPointHistory is a fixed-size ring buffer of timestamped hold
+ *  points & view rotations. Fitting a line through recent samples
+ *  gives throw velocities that depend on elapsed time rather than on
+ *  whatever happened during the last frame, so throws feel the same
+ *  at any frame or server tick rate.
+ */
+
+
+/*--- History Functions ---*/
+
+void FHoldPointHistory::AddSample(double Time, const FVector& Location, const FRotator& Rotation) {
+	FHoldPointSample& Sample = Samples[NextIndex];
+	Sample.Time = Time;
+	Sample.Location = Location;
+	Sample.Rotation = Rotation.Quaternion();
+
+	NextIndex = (NextIndex + 1) % CAPACITY;
+	Count = FMath::Min(Count + 1, CAPACITY);
+}
+
+void FHoldPointHistory::Reset() {
+	NextIndex = 0;
+	Count = 0;
+}
+
+bool FHoldPointHistory::EstimateVelocity(double Window, FVector& OutLinearVelocity, FVector& OutAngularVelocity) const {
+	OutLinearVelocity = FVector::ZeroVector;
+	OutAngularVelocity = FVector::ZeroVector;
+	if (Count < 2) return false;
+
+	// Gather Samples Within Window
+	const FHoldPointSample& Newest = GetSample(0);
+	int32 SampleCount = 1;
+	while (SampleCount < Count && Newest.Time - GetSample(SampleCount).Time <= Window) {
+		SampleCount++;
+	}
+	if (SampleCount < 2) return false;
+
+	// Means (Rotations Expressed as Rotation Vectors Relative to Newest Sample)
+	double MeanTime = 0.0;
+	FVector MeanLocation = FVector::ZeroVector;
+	FVector MeanRotation = FVector::ZeroVector;
+	FVector RotationVectors[CAPACITY];
+	for (int32 Age = 0; Age < SampleCount; Age++) {
+		const FHoldPointSample& Sample = GetSample(Age);
+		FQuat Delta = Sample.Rotation * Newest.Rotation.Inverse();
+		if (Delta.W < 0.0) Delta = -Delta; // Shortest Arc
+		RotationVectors[Age] = Delta.ToRotationVector();
+
+		MeanTime += Sample.Time;
+		MeanLocation += Sample.Location;
+		MeanRotation += RotationVectors[Age];
+	}
+	MeanTime /= SampleCount;
+	MeanLocation /= SampleCount;
+	MeanRotation /= SampleCount;
+
+	// Slope = Cov(t, x) / Var(t)
+	double TimeVariance = 0.0;
+	FVector LocationCovariance = FVector::ZeroVector;
+	FVector RotationCovariance = FVector::ZeroVector;
+	for (int32 Age = 0; Age < SampleCount; Age++) {
+		const FHoldPointSample& Sample = GetSample(Age);
+		double TimeOffset = Sample.Time - MeanTime;
+		TimeVariance += TimeOffset * TimeOffset;
+		LocationCovariance += (Sample.Location - MeanLocation) * TimeOffset;
+		RotationCovariance += (RotationVectors[Age] - MeanRotation) * TimeOffset;
+	}
+	if (TimeVariance <= UE_DOUBLE_SMALL_NUMBER) return false;
+
+	OutLinearVelocity = LocationCovariance / TimeVariance;
+	OutAngularVelocity = FMath::RadiansToDegrees(RotationCovariance / TimeVariance);
+	return true;
+}
+
+const FHoldPointSample& FHoldPointHistory::GetSample(int32 Age) const {
+	return Samples[(NextIndex - 1 - Age + CAPACITY) % CAPACITY];
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/*
+ *  HoldPointHistory.h                                Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for HoldPointHistory.cpp.
+ */
+
+struct FHoldPointSample {
+	double Time = 0.0;
+	FVector Location = FVector::ZeroVector;
+	FQuat Rotation = FQuat::Identity;
+};
+
+class FHoldPointHistory {
+
+	/*--- Constants ---*/
+
+	public: static constexpr int32 CAPACITY = 16;
+
+
+	/*--- Variables ---*/
+
+	private: FHoldPointSample Samples[CAPACITY];
+	private: int32 NextIndex = 0;
+	private: int32 Count = 0;
+
+
+	/*--- History Functions ---*/
+
+	public: void AddSample(double Time, const FVector& Location, const FRotator& Rotation);
+
+	public: void Reset();
+
+	/** Least-squares fit over samples from the last Window seconds. Velocities are in world space;
+	 *  angular velocity is in degrees per second. Returns false if fewer than two samples qualify.
+	 */
+	public: bool EstimateVelocity(double Window, FVector& OutLinearVelocity, FVector& OutAngularVelocity) const;
+
+	private: const FHoldPointSample& GetSample(int32 Age) const;
+
+};
@@ -1,9 +1,15 @@
 
 #include "InputCharacter.h"
 #include "AllLevels/Input/InputUtility.h"
+#include "AllLevels/SandboxGameInstance.h"
+#include "AllLevels/Utility/SandboxLog.h"
+#include "AllLevels/Utility/SandboxMemory.h"
+#include "AllLevels/Utility/SandboxStats.h"
 #include "Components/InputComponent.h"
 #include "ControllerDiagnosticWidget.h"
 #include "Dependencies/Steam/SteamInputComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
 #include "GameFramework/InputSettings.h"
 #include "Runtime/UMG/Public/Blueprint/WidgetBlueprintLibrary.h"
 #include "UObject/Class.h"
@@ -15,43 +21,68 @@
  *    InputCharacter is one of Sandbox's most base character classes.
  *  It reads all input events from both Steam and Unreal Engine before
  *  delegating to more specific character subclasses.
+ *
+ *  Tick Order
+ *    - Input is polled in TG_PrePhysics, after the controller has
+ *      processed its input and before the character movement
+ *      component consumes the resulting movement input, so nothing
+ *      reaches movement a frame late.
  */
 
 
 /*--- Lifecycle Functions ---*/
 
-AInputCharacter::AInputCharacter() { }
+AInputCharacter::AInputCharacter(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.TickGroup = TG_PrePhysics;
+}
+
+void AInputCharacter::PostInitializeComponents() {
+	Super::PostInitializeComponents();
+
+	// Movement Consumes This Frame's Input
+	if (GetCharacterMovement()) {
+		GetCharacterMovement()->PrimaryComponentTick.AddPrerequisite(this, PrimaryActorTick);
+	}
+}
 
 void AInputCharacter::BeginPlay() {
 	Super::BeginPlay();
 
+	// Dedicated Servers Have No Devices to Read
+#if !UE_SERVER
 	SetupSteamInputComponent();
+#endif
+}
+
+void AInputCharacter::NotifyControllerChanged() {
+	Super::NotifyControllerChanged();
+
+	// Poll Input Only After the Controller Has Processed Its Own
+	if (InputTickPrerequisite) RemoveTickPrerequisiteActor(InputTickPrerequisite);
+	InputTickPrerequisite = Controller;
+	if (InputTickPrerequisite) AddTickPrerequisiteActor(InputTickPrerequisite);
+
+	// Possessed After BeginPlay
+#if !UE_SERVER
+	if (HasActorBegunPlay()) SetupSteamInputComponent();
+#endif
 }
 
 void AInputCharacter::Tick(float DeltaSeconds) {
 
+	// Only a Local Player's Pawn Reads Devices (Bots & Remote Players Get Input Elsewhere)
+	if (!IsLocallyControlled() || !IsPlayerControlled()) return;
+	SANDBOX_SCOPE(Input);
+	LLM_SCOPE_BYTAG(Sandbox_Input);
+
 	// Process Input
-	if (SteamInputComponent->IsSteamInputAvailable()) {
+	if (SteamInputComponent && SteamInputComponent->IsSteamInputAvailable()) {
 		SteamInputComponent->OnTick(DeltaSeconds);
 	} else {
 		OnStickLeftInput(NormalizeStickInput(CurrentUnrealStickLeftInput));
 		OnStickRightInput(NormalizeStickInput(CurrentUnrealStickRightInput));
 	}
-
-	// Handle Controller Diagnostic Display
-	if (IsControllerDiagnosticEnabled && IsHoldingToToggleControllerDiagnostic) {
-		ToggleControllerDiagnosticCurrentTime += DeltaSeconds;
-		if (ToggleControllerDiagnosticCurrentTime >= TOGGLE_CONTROLLER_DIAGNOSTIC_HOLD_TIME) {
-			IsHoldingToToggleControllerDiagnostic = false;
-			ToggleControllerDiagnosticCurrentTime = 0.0f;
-			if (IsControllerDiagnosticShown) {
-				HideControllerDiagnosticWidget();
-			} else {
-				ShowControllerDiagnosticWidget();
-			}
-			
-		}
-	}
 }
 
 
@@ -60,6 +91,7 @@ void AInputCharacter::Tick(float DeltaSeconds) {
 // APawn Override
 void AInputCharacter::SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) {
 	check(PlayerInputComponent);
+	LLM_SCOPE_BYTAG(Sandbox_Input);
 
 	// Unreal Keyboard/Mouse
 	PlayerInputComponent->BindAxis("MouseX", this, &AInputCharacter::OnMouseHorizontal);
@@ -103,6 +135,15 @@ void AInputCharacter::SetupPlayerInputComponent(class UInputComponent* PlayerInp
 }
 
 void AInputCharacter::SetupSteamInputComponent() {
+
+	// Only a Local Player's Pawn Reads Devices, So Bots & Remote Players Never Wait on Steam
+	if (SteamInputComponent || !IsLocallyControlled() || !IsPlayerControlled()) return;
+	LLM_SCOPE_BYTAG(Sandbox_Input);
+
+	// Steam Initializes in the Background During Startup
+	USandboxGameInstance* GameInstance = GetGameInstance<USandboxGameInstance>();
+	if (GameInstance) GameInstance->WaitForSteamInit();
+
 	SteamInputComponent = NewObject<USteamInputComponent>(this);
 	SteamInputComponent->SetupSteamInput();
 
@@ -148,6 +189,7 @@ void AInputCharacter::SetupSteamInputComponent() {
 /*--- Diagnostic Functions ---*/
 
 void AInputCharacter::ShowControllerDiagnosticWidget() {
+#if !UE_SERVER
 	if (IsControllerDiagnosticEnabled && !IsControllerDiagnosticShown) {
 		ControllerDiagnosticWidget = CreateWidget<UControllerDiagnosticWidget>(GetWorld(), ControllerDiagnosticWidgetClass);
         ControllerDiagnosticWidget->AddToViewport();
@@ -155,6 +197,7 @@ void AInputCharacter::ShowControllerDiagnosticWidget() {
 		IsControllerDiagnosticShown = true;
 		ControllerDiagnosticWidget->OnControllerChange(GetCurrentGamepadType());
     }
+#endif
 }
 
 void AInputCharacter::HideControllerDiagnosticWidget() {
@@ -165,8 +208,16 @@ void AInputCharacter::HideControllerDiagnosticWidget() {
     }
 }
 
+void AInputCharacter::ToggleControllerDiagnosticWidget() {
+	if (IsControllerDiagnosticShown) {
+		HideControllerDiagnosticWidget();
+	} else {
+		ShowControllerDiagnosticWidget();
+	}
+}
+
 EGamepadType AInputCharacter::GetCurrentGamepadType() {
-	if (SteamInputComponent->IsSteamInputAvailable()) {
+	if (SteamInputComponent && SteamInputComponent->IsSteamInputAvailable()) {
 		return SteamInputComponent->GetFirstConnectedGamepadType();
 	} else {
 		return EGamepadType::GenericUnreal;
@@ -177,11 +228,11 @@ EGamepadType AInputCharacter::GetCurrentGamepadType() {
 /*--- Overridable Input Handling Functions ---*/
 
 void AInputCharacter::OnMouseHorizontal(float Input) {
-	if (IsDebugLoggingEnabled && GEngine && Input > 0.0f) GEngine->AddOnScreenDebugMessage(-1, 0.5f, FColor::White, "Mouse X: " + FString::SanitizeFloat(Input));
+	if (IsDebugLoggingEnabled && Input > 0.0f) SANDBOX_LOG(Input, "Mouse X: {0}", Input);
 }
 
 void AInputCharacter::OnMouseVertical(float Input) {
-	if (IsDebugLoggingEnabled && GEngine && Input > 0.0f) GEngine->AddOnScreenDebugMessage(-1, 0.5f, FColor::White, "Mouse Y: " + FString::SanitizeFloat(Input));
+	if (IsDebugLoggingEnabled && Input > 0.0f) SANDBOX_LOG(Input, "Mouse Y: {0}", Input);
 }
 
 void AInputCharacter::OnStickLeft(FVector2D Input) {
@@ -194,157 +245,165 @@ void AInputCharacter::OnStickRight(FVector2D Input) {
 
 void AInputCharacter::OnTriggerLeft(float Input) {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnTriggerLeft(Input);
-	if (IsDebugLoggingEnabled && GEngine && Input > 0.0f) GEngine->AddOnScreenDebugMessage(-1, 0.5f, FColor::White, FString::SanitizeFloat(Input));
+	if (IsDebugLoggingEnabled && Input > 0.0f) SANDBOX_LOG(Input, "Trigger Left: {0}", Input);
 }
 
 void AInputCharacter::OnTriggerRight(float Input) {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnTriggerRight(Input);
-	if (IsDebugLoggingEnabled && GEngine && Input > 0.0f) GEngine->AddOnScreenDebugMessage(-1, 0.5f, FColor::White, FString::SanitizeFloat(Input));
+	if (IsDebugLoggingEnabled && Input > 0.0f) SANDBOX_LOG(Input, "Trigger Right: {0}", Input);
 }
 
 void AInputCharacter::OnStickLeftPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnStickLeftPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Stick Left Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Stick Left Press");
 }
 
 void AInputCharacter::OnStickLeftRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnStickLeftRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Stick Left Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Stick Left Release");
 }
 
 void AInputCharacter::OnStickRightPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnStickRightPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Stick Right Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Stick Right Press");
 }
 
 void AInputCharacter::OnStickRightRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnStickRightRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Stick Right Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Stick Right Release");
 }
 
 void AInputCharacter::OnStartPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnStartPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Start Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Start Press");
 }
 
 void AInputCharacter::OnStartRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnStartRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Start Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Start Release");
 }
 
 void AInputCharacter::OnEndPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnEndPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "End Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "End Press");
 }
 
 void AInputCharacter::OnEndRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnEndRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "End Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "End Release");
 }
 
 void AInputCharacter::OnFaceTopPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnFaceTopPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Y Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Y Press");
 }
 
 void AInputCharacter::OnFaceTopRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnFaceTopRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Y Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Y Release");
 }
 
 void AInputCharacter::OnFaceLeftPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnFaceLeftPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "X Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "X Press");
 }
 
 void AInputCharacter::OnFaceLeftRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnFaceLeftRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "X Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "X Release");
 }
 
 void AInputCharacter::OnFaceRightPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnFaceRightPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "B Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "B Press");
 }
 
 void AInputCharacter::OnFaceRightRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnFaceRightRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "B Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "B Release");
 }
 
 void AInputCharacter::OnFaceBottomPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnFaceBottomPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "A Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "A Press");
 }
 
 void AInputCharacter::OnFaceBottomRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnFaceBottomRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "A Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "A Release");
 }
 
 void AInputCharacter::OnBumperLeftPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnBumperLeftPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Bumper Left Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Bumper Left Press");
 }
 
 void AInputCharacter::OnBumperLeftRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnBumperLeftRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Bumper Left Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Bumper Left Release");
 }
 
 void AInputCharacter::OnBumperRightPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnBumperRightPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Bumper Right Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Bumper Right Press");
 }
 
 void AInputCharacter::OnBumperRightRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnBumperRightRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Bumper Right Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Bumper Right Release");
 }
 
 void AInputCharacter::OnDPadUpPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnDPadUpPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "D-Pad Up Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "D-Pad Up Press");
 }
 
 void AInputCharacter::OnDPadUpRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnDPadUpRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "D-Pad Up Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "D-Pad Up Release");
 }
 
 void AInputCharacter::OnDPadLeftPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnDPadLeftPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "D-Pad Left Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "D-Pad Left Press");
 }
 
 void AInputCharacter::OnDPadLeftRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnDPadLeftRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "D-Pad Left Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "D-Pad Left Release");
 }
 
 void AInputCharacter::OnDPadRightPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnDPadRightPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "D-Pad Right Press");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "D-Pad Right Press");
 }
 
 void AInputCharacter::OnDPadRightRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnDPadRightRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "D-Pad Right Release");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "D-Pad Right Release");
 }
 
 void AInputCharacter::OnDPadDownPress() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnDPadDownPress();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "D-Pad Down Press");
-
-	IsHoldingToToggleControllerDiagnostic = true;
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "D-Pad Down Press");
+
+	// Toggle Diagnostic if Held Long Enough
+	if (IsControllerDiagnosticEnabled) {
+		GetWorldTimerManager().SetTimer(
+			ToggleControllerDiagnosticTimerHandle,
+			this,
+			&AInputCharacter::ToggleControllerDiagnosticWidget,
+			TOGGLE_CONTROLLER_DIAGNOSTIC_HOLD_TIME,
+			false
+		);
+	}
 }
 
 void AInputCharacter::OnDPadDownRelease() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnDPadDownRelease();
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "D-Pad Down Release");
-	
-	IsHoldingToToggleControllerDiagnostic = false;
-	ToggleControllerDiagnosticCurrentTime = 0.0f;
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "D-Pad Down Release");
+
+	GetWorldTimerManager().ClearTimer(ToggleControllerDiagnosticTimerHandle);
 }
 
 
@@ -353,12 +412,12 @@ void AInputCharacter::OnDPadDownRelease() {
 
 void AInputCharacter::OnControllerConnected() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnControllerChange(GetCurrentGamepadType());
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Controller Connected");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Controller Connected");
 }
 
 void AInputCharacter::OnControllerDisconnected() {
 	if (ControllerDiagnosticWidget && IsControllerDiagnosticShown) ControllerDiagnosticWidget->OnControllerChange(GetCurrentGamepadType());
-	if (IsDebugLoggingEnabled && GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, "Controller Disconnected");
+	if (IsDebugLoggingEnabled) SANDBOX_LOG(Input, "Controller Disconnected");
 }
 
 
@@ -21,6 +21,9 @@ class SANDBOX_API AInputCharacter : public ACharacter {
 
 	GENERATED_BODY()
 
+	// Bots Drive the Same Input Handlers a Player Would
+	friend class ASandboxBotController;
+
 	/*--- Constants  ---*/
 
 	private: const float TOGGLE_CONTROLLER_DIAGNOSTIC_HOLD_TIME = 3.0f;
@@ -51,17 +54,23 @@ class SANDBOX_API AInputCharacter : public ACharacter {
 	private: FVector2D CurrentUnrealStickLeftInput = FVector2D::ZeroVector;
 	private: FVector2D CurrentUnrealStickRightInput = FVector2D::ZeroVector;
 
-	private: bool IsHoldingToToggleControllerDiagnostic = false;
-	private: float ToggleControllerDiagnosticCurrentTime = 0.0f;
+	private: FTimerHandle ToggleControllerDiagnosticTimerHandle;
+
+	private: UPROPERTY()
+	AController* InputTickPrerequisite = nullptr;
 
 
 	/*--- Lifecycle Functions ---*/
 
-	public: AInputCharacter();
+	public: AInputCharacter(const FObjectInitializer& ObjectInitializer);
 
+	protected: virtual void PostInitializeComponents() override;
 	protected: virtual void BeginPlay() override;
 	protected: virtual void Tick(float DeltaSeconds) override;
 
+	// APawn Override
+	public: virtual void NotifyControllerChanged() override;
+
 
 	/*--- Setup Functions ---*/
 
@@ -77,6 +86,8 @@ class SANDBOX_API AInputCharacter : public ACharacter {
 
 	private: void HideControllerDiagnosticWidget();
 
+	private: void ToggleControllerDiagnosticWidget();
+
 	private: EGamepadType GetCurrentGamepadType();
 
 
@@ -0,0 +1,92 @@
+
+#include "PhysicsHandlePoolSubsystem.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "PhysicsEngine/PhysicsHandleComponent.h"
+#include "AllLevels/Utility/SandboxMemory.h"
+
+/*
+ *  PhysicsHandlePoolSubsystem.cpp                    Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    PhysicsHandlePoolSubsystem owns every physics handle in the
+ *  world. Grabbers lease a handle when they pick something up and
+ *  return it on release, so handle count tracks objects actually
+ *  held rather than the number of characters in the level.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+void UPhysicsHandlePoolSubsystem::OnWorldBeginPlay(UWorld& InWorld) {
+	Super::OnWorldBeginPlay(InWorld);
+
+	// Prewarm Pool to Avoid Registration Hitches on First Grabs
+	for (int32 Index = 0; Index < INITIAL_POOL_SIZE; Index++) {
+		UPhysicsHandleComponent* Handle = CreateHandle();
+		if (Handle) AvailableHandles.Add(Handle);
+	}
+}
+
+void UPhysicsHandlePoolSubsystem::Deinitialize() {
+	for (UPhysicsHandleComponent* Handle : LeasedHandles) {
+		if (Handle) Handle->ReleaseComponent();
+	}
+
+	AvailableHandles.Empty();
+	LeasedHandles.Empty();
+	PoolOwner = nullptr;
+
+	Super::Deinitialize();
+}
+
+bool UPhysicsHandlePoolSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const {
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+/*--- Pool Functions ---*/
+
+UPhysicsHandleComponent* UPhysicsHandlePoolSubsystem::LeaseHandle() {
+	UPhysicsHandleComponent* Handle = AvailableHandles.Num() > 0 ? AvailableHandles.Pop(false) : CreateHandle();
+
+	if (Handle) {
+		Handle->SetComponentTickEnabled(true);
+		LeasedHandles.Add(Handle);
+	}
+
+	return Handle;
+}
+
+void UPhysicsHandlePoolSubsystem::ReturnHandle(UPhysicsHandleComponent* Handle) {
+	if (!Handle || LeasedHandles.RemoveSingleSwap(Handle, false) == 0) return;
+
+	// Idle Handles Don't Tick
+	Handle->ReleaseComponent();
+	Handle->SetComponentTickEnabled(false);
+	AvailableHandles.Add(Handle);
+}
+
+UPhysicsHandleComponent* UPhysicsHandlePoolSubsystem::CreateHandle() {
+	LLM_SCOPE_BYTAG(Sandbox_Grab);
+
+	AActor* Owner = GetPoolOwner();
+	if (!Owner) return nullptr;
+
+	UPhysicsHandleComponent* Handle = NewObject<UPhysicsHandleComponent>(Owner);
+	Handle->RegisterComponent();
+	Handle->SetComponentTickEnabled(false);
+	return Handle;
+}
+
+AActor* UPhysicsHandlePoolSubsystem::GetPoolOwner() {
+	if (!PoolOwner) {
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.Name = FName(TEXT("PhysicsHandlePool"));
+		SpawnParameters.NameMode = FActorSpawnParameters::ESpawnActorNameMode::Requested;
+		SpawnParameters.ObjectFlags |= RF_Transient;
+		PoolOwner = GetWorld()->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParameters);
+	}
+
+	return PoolOwner;
+}
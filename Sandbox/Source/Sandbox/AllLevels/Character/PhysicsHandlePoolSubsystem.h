@@ -0,0 +1,60 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "PhysicsHandlePoolSubsystem.generated.h"
+
+class UPhysicsHandleComponent;
+
+/*
+ *  PhysicsHandlePoolSubsystem.h                      Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for PhysicsHandlePoolSubsystem.cpp.
+ */
+
+UCLASS()
+class SANDBOX_API UPhysicsHandlePoolSubsystem : public UWorldSubsystem {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	private: const int32 INITIAL_POOL_SIZE = 8;
+
+
+	/*--- Variables ---*/
+
+	private: UPROPERTY()
+	AActor* PoolOwner = nullptr;
+
+	private: UPROPERTY()
+	TArray<UPhysicsHandleComponent*> AvailableHandles;
+
+	private: UPROPERTY()
+	TArray<UPhysicsHandleComponent*> LeasedHandles;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+	public: virtual void Deinitialize() override;
+
+	protected: virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+
+	/*--- Pool Functions ---*/
+
+	/** Returns an idle, registered physics handle. The pool grows if every handle is leased. **/
+	public: UPhysicsHandleComponent* LeaseHandle();
+
+	/** Releases whatever the handle holds and makes it available to the next grabber. **/
+	public: void ReturnHandle(UPhysicsHandleComponent* Handle);
+
+	private: UPhysicsHandleComponent* CreateHandle();
+
+	private: AActor* GetPoolOwner();
+
+};
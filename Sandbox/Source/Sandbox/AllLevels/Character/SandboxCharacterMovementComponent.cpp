@@ -0,0 +1,188 @@
+
+#include "SandboxCharacterMovementComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "GameFramework/Character.h"
+#include "AllLevels/Utility/SandboxStats.h"
+
+/*
+ *  SandboxCharacterMovementComponent.cpp             Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxCharacterMovementComponent adds network predicted flight
+ *  to the standard character movement. Flight mode and vertical
+ *  thrust are part of every saved move, and the capsule resize that
+ *  comes with takeoff and landing happens inside the movement update
+ *  itself, so client and server stay in lockstep.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+USandboxCharacterMovementComponent::USandboxCharacterMovementComponent() {
+	WantsToFly = false;
+	WantsToThrustUp = false;
+	WantsToThrustDown = false;
+}
+
+
+/*--- Flight Functions ---*/
+
+void USandboxCharacterMovementComponent::SetWantsToFly(bool ShouldFly) {
+	WantsToFly = ShouldFly;
+}
+
+bool USandboxCharacterMovementComponent::GetWantsToFly() const {
+	return WantsToFly;
+}
+
+void USandboxCharacterMovementComponent::SetThrustUp(bool ShouldThrust) {
+	WantsToThrustUp = ShouldThrust;
+}
+
+void USandboxCharacterMovementComponent::SetThrustDown(bool ShouldThrust) {
+	WantsToThrustDown = ShouldThrust;
+}
+
+
+/*--- Movement Overrides ---*/
+
+void USandboxCharacterMovementComponent::UpdateCharacterStateBeforeMovement(float DeltaSeconds) {
+	SANDBOX_SCOPE(Movement);
+	Super::UpdateCharacterStateBeforeMovement(DeltaSeconds);
+
+	// Simulated Proxies Take Their Mode From Replication
+	if (CharacterOwner && CharacterOwner->GetLocalRole() == ROLE_SimulatedProxy) return;
+
+	if (WantsToFly && !IsFlying()) {
+		SetMovementMode(MOVE_Flying);
+	} else if (!WantsToFly && IsFlying()) {
+		SetMovementMode(MOVE_Walking);
+	}
+}
+
+void USandboxCharacterMovementComponent::OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) {
+	const bool WasFlying = PreviousMovementMode == MOVE_Flying;
+
+	if (CharacterOwner && UpdatedComponent && WasFlying != IsFlying()) {
+		UCapsuleComponent* Capsule = CharacterOwner->GetCapsuleComponent();
+		const ACharacter* DefaultCharacter = CharacterOwner->GetClass()->GetDefaultObject<ACharacter>();
+		const float WalkingCapsuleHalfHeight = DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+
+		// Shrink for Flight and Rise by the Eye Offset, Reverse on Landing
+		Capsule->SetCapsuleHalfHeight(IsFlying() ? FlyingCapsuleHalfHeight : WalkingCapsuleHalfHeight);
+
+		/* Note: Simulated proxies only resize. Their location is replicated from a
+		 *       server that has already moved the capsule.
+		 */
+		if (CharacterOwner->GetLocalRole() != ROLE_SimulatedProxy) {
+			UpdatedComponent->MoveComponent(
+				FVector(0.0f, 0.0f, IsFlying() ? FlyingCapsuleRaise : -FlyingCapsuleRaise),
+				UpdatedComponent->GetComponentQuat(),
+				false, // Whether to Sweep
+				nullptr,
+				MOVECOMP_NoFlags,
+				ETeleportType::TeleportPhysics
+			);
+		}
+	}
+
+	// Notifies the Character After the Capsule Has Settled
+	Super::OnMovementModeChanged(PreviousMovementMode, PreviousCustomMode);
+}
+
+void USandboxCharacterMovementComponent::PhysFlying(float DeltaTime, int32 Iterations) {
+	SANDBOX_SCOPE(Movement);
+	const float Thrust = (WantsToThrustUp ? 1.0f : 0.0f) - (WantsToThrustDown ? 1.0f : 0.0f);
+
+	// Thrust Along the View's Up Axis (Control Rotation Is Part of Every Move)
+	if (Thrust != 0.0f && CharacterOwner) {
+		const FVector ThrustDirection = FRotationMatrix(CharacterOwner->GetControlRotation()).GetUnitAxis(EAxis::Z);
+		const float MaxAcceleration = GetMaxAcceleration();
+		Acceleration = (Acceleration + ThrustDirection * Thrust * FlightThrustScale * MaxAcceleration).GetClampedToMaxSize(MaxAcceleration);
+	}
+
+	Super::PhysFlying(DeltaTime, Iterations);
+}
+
+
+/*--- Network Prediction Functions ---*/
+
+FNetworkPredictionData_Client* USandboxCharacterMovementComponent::GetPredictionData_Client() const {
+	if (!ClientPredictionData) {
+		USandboxCharacterMovementComponent* MutableThis = const_cast<USandboxCharacterMovementComponent*>(this);
+		MutableThis->ClientPredictionData = new FNetworkPredictionData_Client_Sandbox(*this);
+	}
+
+	return ClientPredictionData;
+}
+
+void USandboxCharacterMovementComponent::UpdateFromCompressedFlags(uint8 Flags) {
+	Super::UpdateFromCompressedFlags(Flags);
+
+	WantsToFly = (Flags & FSavedMove_Character::FLAG_Custom_0) != 0;
+	WantsToThrustUp = (Flags & FSavedMove_Character::FLAG_Custom_1) != 0;
+	WantsToThrustDown = (Flags & FSavedMove_Character::FLAG_Custom_2) != 0;
+}
+
+
+/*--- Saved Move ---*/
+
+void FSavedMove_Sandbox::Clear() {
+	Super::Clear();
+
+	SavedWantsToFly = false;
+	SavedWantsToThrustUp = false;
+	SavedWantsToThrustDown = false;
+}
+
+uint8 FSavedMove_Sandbox::GetCompressedFlags() const {
+	uint8 Flags = Super::GetCompressedFlags();
+
+	if (SavedWantsToFly) Flags |= FLAG_Custom_0;
+	if (SavedWantsToThrustUp) Flags |= FLAG_Custom_1;
+	if (SavedWantsToThrustDown) Flags |= FLAG_Custom_2;
+
+	return Flags;
+}
+
+bool FSavedMove_Sandbox::CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const {
+	const FSavedMove_Sandbox* NewSandboxMove = static_cast<const FSavedMove_Sandbox*>(NewMove.Get());
+
+	if (SavedWantsToFly != NewSandboxMove->SavedWantsToFly) return false;
+	if (SavedWantsToThrustUp != NewSandboxMove->SavedWantsToThrustUp) return false;
+	if (SavedWantsToThrustDown != NewSandboxMove->SavedWantsToThrustDown) return false;
+
+	return Super::CanCombineWith(NewMove, InCharacter, MaxDelta);
+}
+
+void FSavedMove_Sandbox::SetMoveFor(ACharacter* Character, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) {
+	Super::SetMoveFor(Character, InDeltaTime, NewAccel, ClientData);
+
+	const USandboxCharacterMovementComponent* Movement = Cast<USandboxCharacterMovementComponent>(Character->GetCharacterMovement());
+	if (Movement) {
+		SavedWantsToFly = Movement->WantsToFly;
+		SavedWantsToThrustUp = Movement->WantsToThrustUp;
+		SavedWantsToThrustDown = Movement->WantsToThrustDown;
+	}
+}
+
+void FSavedMove_Sandbox::PrepMoveFor(ACharacter* Character) {
+	Super::PrepMoveFor(Character);
+
+	USandboxCharacterMovementComponent* Movement = Cast<USandboxCharacterMovementComponent>(Character->GetCharacterMovement());
+	if (Movement) {
+		Movement->WantsToFly = SavedWantsToFly;
+		Movement->WantsToThrustUp = SavedWantsToThrustUp;
+		Movement->WantsToThrustDown = SavedWantsToThrustDown;
+	}
+}
+
+
+/*--- Client Prediction Data ---*/
+
+FNetworkPredictionData_Client_Sandbox::FNetworkPredictionData_Client_Sandbox(const UCharacterMovementComponent& ClientMovement)
+	: Super(ClientMovement) { }
+
+FSavedMovePtr FNetworkPredictionData_Client_Sandbox::AllocateNewMove() {
+	return FSavedMovePtr(new FSavedMove_Sandbox());
+}
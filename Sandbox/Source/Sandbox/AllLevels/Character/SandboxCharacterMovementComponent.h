@@ -0,0 +1,113 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "SandboxCharacterMovementComponent.generated.h"
+
+/*
+ *  SandboxCharacterMovementComponent.h               Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxCharacterMovementComponent.cpp.
+ */
+
+UCLASS()
+class SANDBOX_API USandboxCharacterMovementComponent : public UCharacterMovementComponent {
+
+	GENERATED_BODY()
+
+
+	/*--- Variables ---*/
+
+	// Capsule Half Height While Flying
+	public: UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Character Movement: Flying")
+	float FlyingCapsuleHalfHeight = 36.0f;
+
+	// How Far the Capsule Rises on Takeoff (and Drops on Landing), Keeping the View Steady
+	public: UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Character Movement: Flying")
+	float FlyingCapsuleRaise = 56.5f;
+
+	// Vertical Thrust as a Fraction of Max Acceleration
+	public: UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="Character Movement: Flying")
+	float FlightThrustScale = 0.8f;
+
+	private: uint8 WantsToFly : 1;
+	private: uint8 WantsToThrustUp : 1;
+	private: uint8 WantsToThrustDown : 1;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: USandboxCharacterMovementComponent();
+
+
+	/*--- Flight Functions ---*/
+
+	/** Requests flight on or off. The mode switch happens inside the next predicted move, so the
+	 *  server applies it at the same point in the move stream as the owning client.
+	 */
+	public: void SetWantsToFly(bool ShouldFly);
+
+	public: bool GetWantsToFly() const;
+
+	public: void SetThrustUp(bool ShouldThrust);
+
+	public: void SetThrustDown(bool ShouldThrust);
+
+
+	/*--- Movement Overrides ---*/
+
+	public: virtual void UpdateCharacterStateBeforeMovement(float DeltaSeconds) override;
+
+	protected: virtual void OnMovementModeChanged(EMovementMode PreviousMovementMode, uint8 PreviousCustomMode) override;
+
+	protected: virtual void PhysFlying(float DeltaTime, int32 Iterations) override;
+
+
+	/*--- Network Prediction Functions ---*/
+
+	public: virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+
+	protected: virtual void UpdateFromCompressedFlags(uint8 Flags) override;
+
+	friend class FSavedMove_Sandbox;
+
+};
+
+
+/* Note: Flight state rides along in the compressed flags of each saved move,
+ *       so it costs no extra bandwidth and replays exactly on correction.
+ *         - FLAG_Custom_0: Wants to Fly
+ *         - FLAG_Custom_1: Thrusting Up
+ *         - FLAG_Custom_2: Thrusting Down
+ */
+
+class FSavedMove_Sandbox : public FSavedMove_Character {
+
+	typedef FSavedMove_Character Super;
+
+	private: uint8 SavedWantsToFly : 1;
+	private: uint8 SavedWantsToThrustUp : 1;
+	private: uint8 SavedWantsToThrustDown : 1;
+
+	public: virtual void Clear() override;
+
+	public: virtual uint8 GetCompressedFlags() const override;
+
+	public: virtual bool CanCombineWith(const FSavedMovePtr& NewMove, ACharacter* InCharacter, float MaxDelta) const override;
+
+	public: virtual void SetMoveFor(ACharacter* Character, float InDeltaTime, FVector const& NewAccel, FNetworkPredictionData_Client_Character& ClientData) override;
+
+	public: virtual void PrepMoveFor(ACharacter* Character) override;
+
+};
+
+class FNetworkPredictionData_Client_Sandbox : public FNetworkPredictionData_Client_Character {
+
+	typedef FNetworkPredictionData_Client_Character Super;
+
+	public: FNetworkPredictionData_Client_Sandbox(const UCharacterMovementComponent& ClientMovement);
+
+	public: virtual FSavedMovePtr AllocateNewMove() override;
+
+};
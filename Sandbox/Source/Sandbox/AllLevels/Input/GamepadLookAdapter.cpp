@@ -3,6 +3,7 @@
 #include <math.h>
 #include <cmath>
 #include "AllLevels/Input/InputUtility.h"
+#include "AllLevels/Utility/SandboxStats.h"
 
 /*
  *  GamepadLookAdapter.cpp                           Chris Cruzen
@@ -36,6 +37,7 @@
 /*--- Primary Player Rotation Function ---*/
 
 FVector2D UGamepadLookAdapter::calculatePlayerRotation(FVector2D Input, float TimeDelta) {
+    SANDBOX_SCOPE(GamepadLook);
 
     // Accommodate Deadzone & Apply Easing Curve
     FVector2D ValidInput = UInputUtility::AccommodateDeadzone(Input, STICK_DEADZONE);
@@ -1,18 +1,230 @@
 
 #include "SandboxGameInstance.h"
+#include "Async/Async.h"
+#include "CoreGlobals.h"
+#include "Interfaces/OnlineIdentityInterface.h"
+#include "Misc/FileHelper.h"
+#include "Misc/ScopeLock.h"
+#include "OnlineSubsystem.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "SteamServiceSubsystem.h"
 #include "Utility/LogUtility.h"
+#include "Utility/SandboxMemory.h"
+#include "Utility/SandboxTimeline.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSandboxStartup, Log, All);
+
+/*
+ *  SandboxGameInstance.cpp                           Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxGameInstance starts the game in named phases and reports
+ *  how long each took, so time-to-interactive can be tracked.
+ *
+ *  Startup Phases
+ *    - AppIdFile: Writes steam_appid.txt (Background Task).
+ *    - SteamInit: Restarts through Steam if needed, initializes the
+ *      client through USteamServiceSubsystem (Which Owns Steam for
+ *      the Plugin Too) and reads the user's Steam ID (Background
+ *      Task, After AppIdFile).
+ *    - StartMapLoad: Loads the default map (Game Thread).
+ *    - OnlineLogin: Logs the first local user in through the online
+ *      subsystem (Asynchronous, Started on the Game Thread Once
+ *      SteamInit Is Done, Since OnlineSubsystemSteam Shares Its
+ *      Client).
+ *
+ *  Note: Anything that touches the Steam API must call
+ *        WaitForSteamInit() first. It returns immediately once the
+ *        background phases are done, which is usually long before
+ *        the first pawn begins play.
+ */
+
+
+/*--- Lifecycle Functions ---*/
 
 void USandboxGameInstance::StartGameInstance() {
-    Super::StartGameInstance();
+	StartupBeginSeconds = FPlatformTime::Seconds();
+	FSandboxTimeline::Get().Mark(TEXT("StartGameInstance"));
 
-	// Generate Steam App ID File, Check if Steam Running, Initialize Client, & Get Steam User ID
-	FFileHelper::SaveStringToFile(TEXT(RAW_APP_ID), TEXT("steam_appid.txt"));
-	SteamAPI_RestartAppIfNecessary(atoi(APP_ID));
-	if (SteamAPI_Init()) {
-		SteamUserId = SteamUser()->GetSteamID();
-	}
+	// Steam (Then Login) Overlaps the Start Map Load
+	LaunchSteamInit();
+
+	BeginStartupPhase(ESandboxStartupPhase::StartMapLoad);
+	Super::StartGameInstance();
+	EndStartupPhase(ESandboxStartupPhase::StartMapLoad, true);
+
+	TryFinishStartup();
+}
+
+void USandboxGameInstance::Shutdown() {
+
+	// Never Tear Down Under a Running Init Task
+	WaitForSteamInit();
+
+	IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get();
+	IOnlineIdentityPtr Identity = OnlineSubsystem ? OnlineSubsystem->GetIdentityInterface() : nullptr;
+	if (Identity.IsValid()) Identity->ClearOnLoginCompleteDelegate_Handle(0, LoginCompleteHandle);
+
+	Super::Shutdown();
 }
 
 void USandboxGameInstance::PrintTestStringFromCode(FString text) {
 	DebugLog(text);
 }
+
+
+/*--- Steam Functions ---*/
+
+void USandboxGameInstance::LaunchSteamInit() {
+#if WITH_SANDBOX_STEAM && !UE_SERVER
+	TWeakObjectPtr<USandboxGameInstance> WeakThis(this);
+
+	// Generate Steam App ID File
+	BeginStartupPhase(ESandboxStartupPhase::AppIdFile);
+	UE::Tasks::FTask AppIdFileTask = UE::Tasks::Launch(TEXT("SandboxAppIdFile"), [this]() {
+		EndStartupPhase(ESandboxStartupPhase::AppIdFile, FFileHelper::SaveStringToFile(TEXT(RAW_APP_ID), TEXT("steam_appid.txt")));
+	});
+
+	// Check if Steam Running, Initialize Client, & Get Steam User ID (Reads the App ID File)
+	SteamInitTask = UE::Tasks::Launch(TEXT("SandboxSteamInit"), [this, WeakThis]() {
+		BeginStartupPhase(ESandboxStartupPhase::SteamInit);
+		if (USteamServiceSubsystem::InitializeSteam(atoi(APP_ID))) {
+			SteamUserId = USteamServiceSubsystem::GetSteamUser()->GetSteamID();
+			IsSteamInitialized = true;
+		}
+		EndStartupPhase(ESandboxStartupPhase::SteamInit, IsSteamInitialized);
+
+		// Login Uses the Steam API, Which Is Never Used While It Initializes
+		AsyncTask(ENamedThreads::GameThread, [WeakThis]() {
+			if (!WeakThis.IsValid()) return;
+			WeakThis->StartOnlineLogin();
+			WeakThis->TryFinishStartup();
+		});
+	}, UE::Tasks::Prerequisites(AppIdFileTask));
+#else
+	// Dedicated Servers & Stub Builds Have No Steam Client to Sign In With
+	BeginStartupPhase(ESandboxStartupPhase::AppIdFile);
+	EndStartupPhase(ESandboxStartupPhase::AppIdFile, true);
+	BeginStartupPhase(ESandboxStartupPhase::SteamInit);
+	EndStartupPhase(ESandboxStartupPhase::SteamInit, true);
+	StartOnlineLogin();
+#endif
+}
+
+bool USandboxGameInstance::WaitForSteamInit() {
+	if (SteamInitTask.IsValid() && !SteamInitTask.IsCompleted()) {
+		UE_LOG(LogSandboxStartup, Log, TEXT("Waiting on Steam init"));
+		SteamInitTask.Wait();
+	}
+
+	return IsSteamInitialized;
+}
+
+
+/*--- Online Functions ---*/
+
+void USandboxGameInstance::StartOnlineLogin() {
+	LLM_SCOPE_BYTAG(Sandbox_Sessions);
+	BeginStartupPhase(ESandboxStartupPhase::OnlineLogin);
+
+	// Dedicated Servers Have No Local User
+	if (IsDedicatedServerInstance()) {
+		EndStartupPhase(ESandboxStartupPhase::OnlineLogin, true);
+		return;
+	}
+
+	IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get();
+	IOnlineIdentityPtr Identity = OnlineSubsystem ? OnlineSubsystem->GetIdentityInterface() : nullptr;
+	if (!Identity.IsValid()) {
+		EndStartupPhase(ESandboxStartupPhase::OnlineLogin, false);
+		return;
+	}
+
+	LoginCompleteHandle = Identity->AddOnLoginCompleteDelegate_Handle(
+		0, // Local User Number
+		FOnLoginCompleteDelegate::CreateUObject(this, &USandboxGameInstance::OnLoginComplete)
+	);
+
+	if (!Identity->AutoLogin(0)) {
+		Identity->ClearOnLoginCompleteDelegate_Handle(0, LoginCompleteHandle);
+		EndStartupPhase(ESandboxStartupPhase::OnlineLogin, false);
+	}
+}
+
+void USandboxGameInstance::OnLoginComplete(int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error) {
+	TRACE_CPUPROFILER_EVENT_SCOPE(USandboxGameInstance::OnLoginComplete);
+	LLM_SCOPE_BYTAG(Sandbox_Sessions);
+
+	IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get();
+	IOnlineIdentityPtr Identity = OnlineSubsystem ? OnlineSubsystem->GetIdentityInterface() : nullptr;
+	if (Identity.IsValid()) Identity->ClearOnLoginCompleteDelegate_Handle(LocalUserNum, LoginCompleteHandle);
+
+	if (!bWasSuccessful) UE_LOG(LogSandboxStartup, Warning, TEXT("Online login failed: %s"), *Error);
+
+	EndStartupPhase(ESandboxStartupPhase::OnlineLogin, bWasSuccessful);
+	TryFinishStartup();
+}
+
+
+/*--- Startup Phase Functions ---*/
+
+void USandboxGameInstance::BeginStartupPhase(ESandboxStartupPhase Phase) {
+	FScopeLock Lock(&StartupPhaseLock);
+	StartupPhases[(int32) Phase].StartSeconds = FPlatformTime::Seconds();
+}
+
+void USandboxGameInstance::EndStartupPhase(ESandboxStartupPhase Phase, bool Succeeded) {
+	FScopeLock Lock(&StartupPhaseLock);
+	FSandboxStartupPhaseTiming& Timing = StartupPhases[(int32) Phase];
+	Timing.EndSeconds = FPlatformTime::Seconds();
+	Timing.IsComplete = true;
+	Timing.Succeeded = Succeeded;
+}
+
+bool USandboxGameInstance::IsStartupComplete() const {
+	FScopeLock Lock(&StartupPhaseLock);
+	for (const FSandboxStartupPhaseTiming& Timing : StartupPhases) {
+		if (!Timing.IsComplete) return false;
+	}
+
+	return true;
+}
+
+void USandboxGameInstance::TryFinishStartup() {
+	if (IsStartupReported || !IsStartupComplete()) return;
+
+	IsStartupReported = true;
+	FSandboxTimeline::Get().Mark(TEXT("StartupComplete"));
+	ReportStartup();
+	OnStartupComplete.Broadcast();
+}
+
+void USandboxGameInstance::ReportStartup() const {
+	static const TCHAR* PhaseNames[] = { TEXT("AppIdFile"), TEXT("SteamInit"), TEXT("StartMapLoad"), TEXT("OnlineLogin") };
+	static_assert(UE_ARRAY_COUNT(PhaseNames) == (int32) ESandboxStartupPhase::Count, "Every startup phase needs a name");
+
+	FScopeLock Lock(&StartupPhaseLock);
+	double FinishSeconds = StartupBeginSeconds;
+
+	// Offsets Are From StartGameInstance(), Overlapping Phases Show Up as Overlapping Ranges
+	for (int32 Index = 0; Index < (int32) ESandboxStartupPhase::Count; Index++) {
+		const FSandboxStartupPhaseTiming& Timing = StartupPhases[Index];
+		UE_LOG(
+			LogSandboxStartup, Log,
+			TEXT("%-12s %8.1fms -> %8.1fms (%.1fms)%s"),
+			PhaseNames[Index],
+			(Timing.StartSeconds - StartupBeginSeconds) * 1000.0,
+			(Timing.EndSeconds - StartupBeginSeconds) * 1000.0,
+			(Timing.EndSeconds - Timing.StartSeconds) * 1000.0,
+			Timing.Succeeded ? TEXT("") : TEXT(" FAILED")
+		);
+		FinishSeconds = FMath::Max(FinishSeconds, Timing.EndSeconds);
+	}
+
+	UE_LOG(
+		LogSandboxStartup, Log,
+		TEXT("Startup finished %.1fms after the game instance started, %.2fs after launch"),
+		(FinishSeconds - StartupBeginSeconds) * 1000.0,
+		FinishSeconds - GStartTime
+	);
+}
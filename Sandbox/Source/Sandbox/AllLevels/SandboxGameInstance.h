@@ -2,14 +2,36 @@
 
 #include "CoreMinimal.h"
 #include "AdvancedFriendsGameInstance.h"
-#pragma warning(push)                              // Push current precompiler warning configuration to stack
-#pragma warning(disable:4996)                      // Disable pesky steam api warnings
+#include "HAL/CriticalSection.h"
+#include "Tasks/Task.h"
+#include <atomic>
+#if WITH_SANDBOX_STEAM
+THIRD_PARTY_INCLUDES_START                         // Disable pesky steam api warnings (On Every Compiler)
 #include "Dependencies/Steam/Library/steam_api.h"  // Include steam api
-#pragma warning(pop)                               // Restore previous precompiler warning configuration
+THIRD_PARTY_INCLUDES_END                           // Restore previous warning configuration
+#endif
 #include "SandboxGameInstance.generated.h"
 
+class FUniqueNetId;
+
 #define RAW_APP_ID "480"
 
+// Startup Work, Timed Individually (Some Phases Overlap)
+enum class ESandboxStartupPhase : uint8 {
+	AppIdFile,
+	SteamInit,
+	StartMapLoad,
+	OnlineLogin,
+	Count
+};
+
+struct FSandboxStartupPhaseTiming {
+	double StartSeconds = 0.0;
+	double EndSeconds = 0.0;
+	bool IsComplete = false;
+	bool Succeeded = false;
+};
+
 UCLASS(Blueprintable, Category=AllLevels)
 class SANDBOX_API USandboxGameInstance : public UAdvancedFriendsGameInstance {
 
@@ -18,11 +40,54 @@ class SANDBOX_API USandboxGameInstance : public UAdvancedFriendsGameInstance {
 protected:
 	virtual void StartGameInstance() override;
 
+	virtual void Shutdown() override;
+
 public:
 	UFUNCTION(BlueprintCallable)
 	void PrintTestStringFromCode(FString text);
 
+	/** Blocks until Steam has finished initializing in the background. Returns whether it succeeded. **/
+	bool WaitForSteamInit();
+
+	bool IsStartupComplete() const;
+
+	/** Broadcast once every startup phase has finished. **/
+	FSimpleMulticastDelegate OnStartupComplete;
+
+#if WITH_SANDBOX_STEAM
+	// Only Valid After WaitForSteamInit()
 	CSteamID SteamUserId;
+#endif
+
+	static constexpr const char* APP_ID = RAW_APP_ID;
+
+private:
+	void LaunchSteamInit();
+
+	void StartOnlineLogin();
+
+	void OnLoginComplete(int32 LocalUserNum, bool bWasSuccessful, const FUniqueNetId& UserId, const FString& Error);
+
+	void BeginStartupPhase(ESandboxStartupPhase Phase);
+
+	// Thread Safe, Background Phases Finish Off the Game Thread
+	void EndStartupPhase(ESandboxStartupPhase Phase, bool Succeeded);
+
+	void TryFinishStartup();
+
+	void ReportStartup() const;
+
+	UE::Tasks::FTask SteamInitTask;
+
+	std::atomic<bool> IsSteamInitialized { false };
+
+	FDelegateHandle LoginCompleteHandle;
+
+	mutable FCriticalSection StartupPhaseLock;
+
+	FSandboxStartupPhaseTiming StartupPhases[(int32) ESandboxStartupPhase::Count];
+
+	double StartupBeginSeconds = 0.0;
 
-	static constexpr char* APP_ID = RAW_APP_ID;
+	bool IsStartupReported = false;
 };
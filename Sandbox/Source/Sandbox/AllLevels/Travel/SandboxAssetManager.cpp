@@ -0,0 +1,195 @@
+
+#include "SandboxAssetManager.h"
+#include "Engine/Engine.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSandboxAssets, Log, All);
+
+/*
+ *  SandboxAssetManager.cpp                           Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxAssetManager is the project's asset manager (set in
+ *  DefaultEngine.ini). It scans two primary asset types, Map for
+ *  every level and MenuArt for the menu levels' textures (map
+ *  thumbnails, icons, frames), so menus can reference them softly
+ *  rather than loading everything with the menu.
+ *
+ *    Menu widgets ask for their art through LoadMenuArt, which hands
+ *  back a placeholder right away and loads the real texture on the
+ *  async loading thread. Only a few loads run at once, the rest wait
+ *  in priority order, so whatever is on screen arrives first and
+ *  offscreen entries fill in behind it. Once a map outside MenuMaps
+ *  is entered, every menu texture is released, so gameplay doesn't
+ *  carry the menus' memory.
+ *
+ *  Note: Requests for an already loaded texture skip the queue and
+ *        call back immediately. Widget Blueprints reach the asset
+ *        manager through Get Sandbox Asset Manager.
+ */
+
+
+/*--- Primary Asset Types ---*/
+
+const FPrimaryAssetType USandboxAssetManager::MenuArtType = FName(TEXT("MenuArt"));
+
+
+/*--- Lifecycle Functions ---*/
+
+USandboxAssetManager& USandboxAssetManager::Get() {
+	return *CastChecked<USandboxAssetManager>(GEngine->AssetManager);
+}
+
+USandboxAssetManager* USandboxAssetManager::GetSandboxAssetManager() {
+	return GEngine ? Cast<USandboxAssetManager>(GEngine->AssetManager) : nullptr;
+}
+
+void USandboxAssetManager::StartInitialLoading() {
+	Super::StartInitialLoading();
+
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &USandboxAssetManager::OnPostLoadMap);
+
+	UE_LOG(LogSandboxAssets, Log, TEXT("Scanned %d maps and %d menu textures"),
+		GetNumPrimaryAssetsOfType(MapType), GetNumPrimaryAssetsOfType(MenuArtType));
+}
+
+void USandboxAssetManager::BeginDestroy() {
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	Super::BeginDestroy();
+}
+
+
+/*--- Map Functions ---*/
+
+TArray<FPrimaryAssetId> USandboxAssetManager::GetMaps() const {
+	TArray<FPrimaryAssetId> Maps;
+	GetPrimaryAssetIdList(MapType, Maps);
+	return Maps;
+}
+
+
+/*--- Menu Art Functions ---*/
+
+UTexture2D* USandboxAssetManager::LoadMenuArt(TSoftObjectPtr<UTexture2D> Texture, ESandboxLoadPriority Priority, FSandboxMenuArtLoaded OnLoaded) {
+	if (Texture.IsNull()) return nullptr;
+
+	if (UTexture2D* LoadedTexture = Texture.Get()) {
+		OnLoaded.ExecuteIfBound(LoadedTexture);
+		return LoadedTexture;
+	}
+
+	// Tiny, Loaded Once on the First Request
+	if (!Placeholder) Placeholder = LoadObject<UTexture2D>(nullptr, PLACEHOLDER_PATH);
+
+	const FSoftObjectPath Path = Texture.ToSoftObjectPath();
+	const bool IsNewLoad = !MenuArtLoads.Contains(Path);
+	FSandboxMenuArtLoad& Load = MenuArtLoads.FindOrAdd(Path);
+	if (!Load.IsStarted) {
+		// Newer Requests for the Same Priority Wait Behind Older Ones
+		if (IsNewLoad || Priority > Load.Priority) {
+			Load.Priority = Priority;
+			Load.RequestOrder = NextRequestOrder++;
+		}
+	}
+	if (OnLoaded.IsBound()) Load.Callbacks.Add(OnLoaded);
+
+	StartMenuArtLoads();
+	return Placeholder;
+}
+
+void USandboxAssetManager::UnloadMenuArt() {
+	int32 Released = 0;
+	for (TPair<FSoftObjectPath, FSandboxMenuArtLoad>& Each : MenuArtLoads) {
+		const TSharedPtr<FStreamableHandle>& Handle = Each.Value.Handle;
+		if (!Handle.IsValid()) continue;
+
+		if (Handle->IsLoadingInProgress()) {
+			Handle->CancelHandle();
+		} else {
+			Handle->ReleaseHandle();
+		}
+		Released++;
+	}
+
+	MenuArtLoads.Empty();
+	MenuArtLoadsInFlight = 0;
+	Placeholder = nullptr;
+
+	if (Released > 0) UE_LOG(LogSandboxAssets, Log, TEXT("Released %d menu textures"), Released);
+}
+
+void USandboxAssetManager::StartMenuArtLoads() {
+	while (MenuArtLoadsInFlight < MAX_MENU_ART_LOADS) {
+
+		// Highest Priority First, Then Oldest Request
+		const FSoftObjectPath* NextPath = nullptr;
+		const FSandboxMenuArtLoad* NextLoad = nullptr;
+		for (const TPair<FSoftObjectPath, FSandboxMenuArtLoad>& Each : MenuArtLoads) {
+			const FSandboxMenuArtLoad& Load = Each.Value;
+			if (Load.IsStarted) continue;
+
+			if (!NextLoad || Load.Priority > NextLoad->Priority || (Load.Priority == NextLoad->Priority && Load.RequestOrder < NextLoad->RequestOrder)) {
+				NextPath = &Each.Key;
+				NextLoad = &Load;
+			}
+		}
+		if (!NextLoad) return;
+
+		const FSoftObjectPath Path = *NextPath;
+		const ESandboxLoadPriority Priority = NextLoad->Priority;
+		MenuArtLoads[Path].IsStarted = true;
+		MenuArtLoadsInFlight++;
+
+		// Completion Can Run Inside This Call, and Its Callbacks Can Request More Art
+		TSharedPtr<FStreamableHandle> Handle = GetStreamableManager().RequestAsyncLoad(
+			Path,
+			FStreamableDelegate::CreateUObject(this, &USandboxAssetManager::OnMenuArtLoaded, Path),
+			Priority == ESandboxLoadPriority::Visible ? FStreamableManager::AsyncLoadHighPriority : FStreamableManager::DefaultAsyncLoadPriority,
+			false, // Manage Active Handle
+			false, // Start Stalled
+			TEXT("SandboxMenuArt")
+		);
+
+		if (FSandboxMenuArtLoad* Load = MenuArtLoads.Find(Path)) {
+			Load->Handle = Handle;
+		} else if (Handle.IsValid()) {
+			// Menu Art Was Unloaded From a Callback, Don't Keep This One
+			Handle->ReleaseHandle();
+		}
+	}
+}
+
+void USandboxAssetManager::OnMenuArtLoaded(FSoftObjectPath Path) {
+	FSandboxMenuArtLoad* Load = MenuArtLoads.Find(Path);
+	if (!Load) return;
+
+	// Callbacks May Add to MenuArtLoads, So Nothing Is Held Into the Map While They Run
+	TArray<FSandboxMenuArtLoaded> Callbacks = MoveTemp(Load->Callbacks);
+	MenuArtLoadsInFlight = FMath::Max(MenuArtLoadsInFlight - 1, 0);
+
+	// A Failed Load Is Forgotten, So the Next Request Tries Again Instead of Waiting Forever
+	UTexture2D* Texture = Cast<UTexture2D>(Path.ResolveObject());
+	if (!Texture) {
+		UE_LOG(LogSandboxAssets, Warning, TEXT("Menu texture %s failed to load"), *Path.ToString());
+		if (Load->Handle.IsValid()) Load->Handle->ReleaseHandle();
+		MenuArtLoads.Remove(Path);
+	}
+
+	for (FSandboxMenuArtLoaded& Callback : Callbacks) {
+		Callback.ExecuteIfBound(Texture ? Texture : Placeholder.Get());
+	}
+
+	StartMenuArtLoads();
+}
+
+
+/*--- Engine Hooks ---*/
+
+void USandboxAssetManager::OnPostLoadMap(UWorld* LoadedWorld) {
+	if (!LoadedWorld || !LoadedWorld->IsGameWorld()) return;
+
+	const FString MapName = UWorld::RemovePIEPrefix(LoadedWorld->GetMapName());
+	if (!MenuMaps.Contains(MapName)) UnloadMenuArt();
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "SandboxAssetManager.generated.h"
+
+class UTexture2D;
+class UWorld;
+
+/*
+ *  SandboxAssetManager.h                             Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxAssetManager.cpp.
+ */
+
+// Order Menu Art Is Loaded In, Highest First
+UENUM(BlueprintType)
+enum class ESandboxLoadPriority : uint8 {
+	Background    UMETA(DisplayName = "Background"),
+	Offscreen     UMETA(DisplayName = "Offscreen"),
+	Visible       UMETA(DisplayName = "Visible")
+};
+
+DECLARE_DYNAMIC_DELEGATE_OneParam(FSandboxMenuArtLoaded, UTexture2D*, Texture);
+
+// One Requested Texture, Shared by Every Widget Showing It
+struct FSandboxMenuArtLoad {
+	ESandboxLoadPriority Priority = ESandboxLoadPriority::Background;
+	uint64 RequestOrder = 0;
+	bool IsStarted = false;
+	TSharedPtr<FStreamableHandle> Handle;
+	TArray<FSandboxMenuArtLoaded> Callbacks;
+};
+
+UCLASS(Config=Game)
+class SANDBOX_API USandboxAssetManager : public UAssetManager {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	// Menu Art Loads in Flight at Once, the Rest Wait in Priority Order
+	private: const int32 MAX_MENU_ART_LOADS = 4;
+
+	// Shown Until the Requested Texture Arrives
+	private: const TCHAR* PLACEHOLDER_PATH = TEXT("/Game/MenuLevel/Textures/White_Box.White_Box");
+
+
+	/*--- Variables ---*/
+
+	// Textures Under the Menu Levels' Texture Folders (Maps Use the Engine's MapType)
+	public: static const FPrimaryAssetType MenuArtType;
+
+	// Maps That Keep Menu Art Loaded, Any Other Map Releases It
+	private: UPROPERTY(Config) TArray<FString> MenuMaps;
+
+	private: UPROPERTY() TObjectPtr<UTexture2D> Placeholder;
+
+	private: TMap<FSoftObjectPath, FSandboxMenuArtLoad> MenuArtLoads;
+	private: int32 MenuArtLoadsInFlight = 0;
+	private: uint64 NextRequestOrder = 0;
+
+	private: FDelegateHandle PostLoadMapHandle;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: static USandboxAssetManager& Get();
+
+	/** Blueprints' way in to the menu art functions (None If Another Asset Manager Is Configured). **/
+	public: UFUNCTION(BlueprintPure, Category=Assets, meta=(DisplayName="Get Sandbox Asset Manager"))
+	static USandboxAssetManager* GetSandboxAssetManager();
+
+	public: virtual void StartInitialLoading() override;
+
+	public: virtual void BeginDestroy() override;
+
+
+	/*--- Map Functions ---*/
+
+	/** Every cooked map, as scanned from the Map primary asset type (For the Map Select Menu). **/
+	public: UFUNCTION(BlueprintCallable, Category=Assets)
+	TArray<FPrimaryAssetId> GetMaps() const;
+
+
+	/*--- Menu Art Functions ---*/
+
+	/**
+	 * Returns the texture if it is already loaded, otherwise the placeholder, and queues the load.
+	 * OnLoaded fires once the real texture is ready (Right Away When It Already Is).
+	 * Requesting a queued texture again raises its priority, e.g. once it scrolls into view.
+	 **/
+	public: UFUNCTION(BlueprintCallable, Category=Assets)
+	UTexture2D* LoadMenuArt(TSoftObjectPtr<UTexture2D> Texture, ESandboxLoadPriority Priority, FSandboxMenuArtLoaded OnLoaded);
+
+	/** Releases every menu texture, loaded or queued. Called automatically on entering gameplay. **/
+	public: UFUNCTION(BlueprintCallable, Category=Assets)
+	void UnloadMenuArt();
+
+	private: void StartMenuArtLoads();
+
+	private: void OnMenuArtLoaded(FSoftObjectPath Path);
+
+
+	/*--- Engine Hooks ---*/
+
+	private: void OnPostLoadMap(UWorld* LoadedWorld);
+
+};
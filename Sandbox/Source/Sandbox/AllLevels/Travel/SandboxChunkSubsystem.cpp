@@ -0,0 +1,165 @@
+
+#include "SandboxChunkSubsystem.h"
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Engine/AssetManager.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "IPlatformFilePak.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSandboxChunks, Log, All);
+
+/*
+ *  SandboxChunkSubsystem.cpp                         Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxChunkSubsystem mounts content chunks as maps need them.
+ *  Cooking splits the game into one IoStore container per level
+ *  (see the chunk rules in DefaultGame.ini): chunk 0 holds the engine,
+ *  StartLevel and LoadingLevel, chunk 1 the shared AllLevels content,
+ *  and every other level gets its own. Before any map loads, by hard
+ *  or seamless travel, its chunks are mounted from the Paks folder,
+ *  and chunks stay mounted once they are. A map's chunks are read
+ *  from the cooked asset registry, so the chunk rules are the only
+ *  place they are assigned.
+ *
+ *    By default the engine mounts every container at startup, and
+ *  this only confirms they are there. Launching with
+ *  -StartupPaksWildcard=pakchunk0-*.pak opens just StartMap's chunk,
+ *  and the shared chunks are mounted here before the game instance
+ *  loads, so cold start and the resident container indexes stay the
+ *  same however many levels are added.
+ *
+ *  Note: Editor builds read loose files, every chunk counts as mounted.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+USandboxChunkSubsystem* USandboxChunkSubsystem::Get() {
+	return GEngine ? GEngine->GetEngineSubsystem<USandboxChunkSubsystem>() : nullptr;
+}
+
+void USandboxChunkSubsystem::Initialize(FSubsystemCollectionBase& Collection) {
+	Super::Initialize(Collection);
+
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddUObject(this, &USandboxChunkSubsystem::OnPreLoadMap);
+	SeamlessTravelStartHandle = FWorldDelegates::OnSeamlessTravelStart.AddUObject(this, &USandboxChunkSubsystem::OnSeamlessTravelStart);
+
+	// Engine Subsystems Start Before the Game Instance (A Blueprint in AllLevels) Is Loaded
+	for (const int32 ChunkId : SharedChunks) MountChunk(ChunkId);
+}
+
+void USandboxChunkSubsystem::Deinitialize() {
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	FWorldDelegates::OnSeamlessTravelStart.Remove(SeamlessTravelStartHandle);
+
+	Super::Deinitialize();
+}
+
+
+/*--- Chunk Functions ---*/
+
+bool USandboxChunkSubsystem::MountMapChunks(const FString& MapName) {
+	bool Succeeded = true;
+	for (const int32 ChunkId : SharedChunks) Succeeded &= MountChunk(ChunkId);
+
+	TArray<int32> MapChunks;
+	GetMapChunks(MapName, MapChunks);
+	for (const int32 ChunkId : MapChunks) Succeeded &= MountChunk(ChunkId);
+
+	return Succeeded;
+}
+
+void USandboxChunkSubsystem::GetMapChunks(const FString& MapName, TArray<int32>& OutChunks) const {
+	OutChunks.Reset();
+
+	// Short Names (Menus, Sessions) Resolve Through the Map Primary Assets
+	FString PackageName = FPackageName::ObjectPathToPackageName(MapName);
+	if (!FPackageName::IsValidLongPackageName(PackageName)) {
+		UAssetManager* AssetManager = UAssetManager::GetIfInitialized();
+		if (!AssetManager) return;
+
+		PackageName = AssetManager->GetPrimaryAssetPath(FPrimaryAssetId(UAssetManager::MapType, FName(*MapName))).GetLongPackageName();
+		if (PackageName.IsEmpty()) {
+			UE_LOG(LogSandboxChunks, Warning, TEXT("%s isn't a known map, none of its chunks are mounted"), *MapName);
+			return;
+		}
+	}
+
+	// The Cooked Registry Lists Every Package, Including Those in Unmounted Chunks
+	TArray<FAssetData> Assets;
+	IAssetRegistry::GetChecked().GetAssetsByPackageName(FName(*PackageName), Assets, true);
+	for (const FAssetData& Asset : Assets) {
+		for (const int32 ChunkId : Asset.GetChunkIDs()) OutChunks.AddUnique(ChunkId);
+	}
+}
+
+bool USandboxChunkSubsystem::MountChunk(int32 ChunkId) {
+	if (ChunkId == 0 || IsChunkMounted(ChunkId)) return true;
+
+	FPakPlatformFile* PakPlatformFile = GetPakPlatformFile();
+	if (!PakPlatformFile) {
+		MountedChunks.Add(ChunkId);
+		return true;
+	}
+
+	// Containers Are Named pakchunk<Id>-<Platform>.pak/.utoc/.ucas
+	const FString Prefix = FString::Printf(TEXT("pakchunk%d-"), ChunkId);
+
+	// Already Mounted at Startup (No Wildcard Given)
+	TArray<FString> MountedPaks;
+	PakPlatformFile->GetMountedPakFilenames(MountedPaks);
+	const bool IsMountedAtStartup = MountedPaks.ContainsByPredicate([&Prefix](const FString& Each) {
+		return FPaths::GetCleanFilename(Each).StartsWith(Prefix);
+	});
+	if (IsMountedAtStartup) {
+		MountedChunks.Add(ChunkId);
+		return true;
+	}
+
+	const FString PakDirectory = FPaths::ProjectContentDir() / TEXT("Paks");
+	TArray<FString> PakFiles;
+	IFileManager::Get().FindFiles(PakFiles, *(PakDirectory / Prefix + TEXT("*.pak")), true, false);
+	if (PakFiles.Num() == 0) {
+		UE_LOG(LogSandboxChunks, Warning, TEXT("Chunk %d has no containers in %s"), ChunkId, *PakDirectory);
+		return false;
+	}
+
+	const double StartSeconds = FPlatformTime::Seconds();
+	for (const FString& PakFile : PakFiles) {
+		if (!PakPlatformFile->Mount(*(PakDirectory / PakFile), CHUNK_MOUNT_ORDER)) {
+			UE_LOG(LogSandboxChunks, Error, TEXT("Failed to mount %s"), *PakFile);
+			return false;
+		}
+	}
+
+	MountedChunks.Add(ChunkId);
+	UE_LOG(LogSandboxChunks, Log, TEXT("Mounted chunk %d in %.1fms"), ChunkId, (FPlatformTime::Seconds() - StartSeconds) * 1000.0);
+	return true;
+}
+
+bool USandboxChunkSubsystem::IsChunkMounted(int32 ChunkId) const {
+	return ChunkId == 0 || MountedChunks.Contains(ChunkId);
+}
+
+FPakPlatformFile* USandboxChunkSubsystem::GetPakPlatformFile() {
+	return static_cast<FPakPlatformFile*>(FPlatformFileManager::Get().FindPlatformFile(FPakPlatformFile::GetTypeName()));
+}
+
+
+/*--- Engine Hooks ---*/
+
+void USandboxChunkSubsystem::OnPreLoadMap(const FString& MapUrl) {
+	FString MapName = MapUrl;
+	MapUrl.Split(TEXT("?"), &MapName, nullptr);
+	MountMapChunks(MapName);
+}
+
+void USandboxChunkSubsystem::OnSeamlessTravelStart(UWorld* CurrentWorld, const FString& MapName) {
+	MountMapChunks(MapName);
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/EngineSubsystem.h"
+#include "SandboxChunkSubsystem.generated.h"
+
+class FPakPlatformFile;
+class UWorld;
+
+/*
+ *  SandboxChunkSubsystem.h                           Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxChunkSubsystem.cpp.
+ */
+
+UCLASS(Config=Game)
+class SANDBOX_API USandboxChunkSubsystem : public UEngineSubsystem {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	// Above the Startup Paks, So Nothing in a Later Chunk Is Shadowed
+	private: const uint32 CHUNK_MOUNT_ORDER = 100;
+
+
+	/*--- Variables ---*/
+
+	// Content Every Map Needs, e.g. AllLevels
+	private: UPROPERTY(Config) TArray<int32> SharedChunks;
+
+	private: TSet<int32> MountedChunks;
+
+	private: FDelegateHandle PreLoadMapHandle;
+	private: FDelegateHandle SeamlessTravelStartHandle;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: static USandboxChunkSubsystem* Get();
+
+	public: virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	public: virtual void Deinitialize() override;
+
+
+	/*--- Chunk Functions ---*/
+
+	/** Mounts every chunk a map needs. Called before each map load, call earlier to preload from it. **/
+	public: bool MountMapChunks(const FString& MapName);
+
+	/** Chunks the map's package was cooked into, read from the asset registry. Takes a short or long map name. **/
+	public: void GetMapChunks(const FString& MapName, TArray<int32>& OutChunks) const;
+
+	/** Mounts a chunk's containers from the Paks folder, if they weren't mounted at startup. **/
+	public: bool MountChunk(int32 ChunkId);
+
+	public: bool IsChunkMounted(int32 ChunkId) const;
+
+	private: static FPakPlatformFile* GetPakPlatformFile();
+
+
+	/*--- Engine Hooks ---*/
+
+	private: void OnPreLoadMap(const FString& MapUrl);
+
+	private: void OnSeamlessTravelStart(UWorld* CurrentWorld, const FString& MapName);
+
+};
@@ -0,0 +1,208 @@
+
+#include "SandboxTravelSubsystem.h"
+#include "SandboxChunkSubsystem.h"
+#include "Engine/AssetManager.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/GameModeBase.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/PackageName.h"
+#include "Online/OnlineSessionNames.h"
+#include "OnlineSessionSettings.h"
+#include "OnlineSubsystem.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSandboxTravel, Log, All);
+
+/*
+ *  SandboxTravelSubsystem.cpp                        Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxTravelSubsystem moves players between maps without
+ *  blocking loads. Every game mode is switched to seamless travel,
+ *  so server travel (from here, Blueprints or the console) goes
+ *  through LoadingMap: the destination and its always loaded
+ *  sublevels stream in asynchronously while the transition map keeps
+ *  ticking, and connected clients follow without reconnecting.
+ *
+ *    Each map can list its heavy assets under MapPreloads in
+ *  DefaultGame.ini. PreloadMap starts loading them at high priority
+ *  the moment a map is picked, and holds them until the map is
+ *  entered, so the first frames there don't hitch on them. A host
+ *  advertises its map in its session, which lets a friend's game
+ *  preload it from the session list (PreloadSessionMap) or, at the
+ *  latest, as soon as the join succeeds.
+ *
+ *  Note: Seamless travel is never used in PIE, where the engine
+ *        doesn't support it. Sandbox.Travel.Seamless 0 turns it off
+ *        everywhere, for comparing against hard travel.
+ */
+
+
+/*--- Console Variables ---*/
+
+static TAutoConsoleVariable<bool> CVarSandboxSeamlessTravel(
+	TEXT("Sandbox.Travel.Seamless"),
+	true,
+	TEXT("Whether server travel goes through the transition map instead of a blocking load. Applies to game modes created afterwards.")
+);
+
+
+/*--- Lifecycle Functions ---*/
+
+void USandboxTravelSubsystem::Initialize(FSubsystemCollectionBase& Collection) {
+	Super::Initialize(Collection);
+
+	GameModeInitializedHandle = FGameModeEvents::GameModeInitializedEvent.AddUObject(this, &USandboxTravelSubsystem::OnGameModeInitialized);
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddUObject(this, &USandboxTravelSubsystem::OnPostLoadMap);
+
+	IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get();
+	IOnlineSessionPtr Sessions = OnlineSubsystem ? OnlineSubsystem->GetSessionInterface() : nullptr;
+	if (Sessions.IsValid()) {
+		JoinSessionCompleteHandle = Sessions->AddOnJoinSessionCompleteDelegate_Handle(
+			FOnJoinSessionCompleteDelegate::CreateUObject(this, &USandboxTravelSubsystem::OnJoinSessionComplete)
+		);
+	}
+}
+
+void USandboxTravelSubsystem::Deinitialize() {
+	CancelPreload();
+
+	FGameModeEvents::GameModeInitializedEvent.Remove(GameModeInitializedHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+
+	IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get();
+	IOnlineSessionPtr Sessions = OnlineSubsystem ? OnlineSubsystem->GetSessionInterface() : nullptr;
+	if (Sessions.IsValid()) Sessions->ClearOnJoinSessionCompleteDelegate_Handle(JoinSessionCompleteHandle);
+
+	Super::Deinitialize();
+}
+
+
+/*--- Travel Functions ---*/
+
+bool USandboxTravelSubsystem::TravelToMap(const FString& MapPath, const FString& Options) {
+	UWorld* World = GetGameInstance()->GetWorld();
+	if (!World || World->GetNetMode() == NM_Client) {
+		UE_LOG(LogSandboxTravel, Warning, TEXT("Only the server travels to %s, clients follow it"), *MapPath);
+		return false;
+	}
+
+	PreloadMap(MapPath);
+
+	// Game Modes Created Before a Settings Change Pick It Up Here
+	if (AGameModeBase* GameMode = World->GetAuthGameMode()) {
+		GameMode->bUseSeamlessTravel = ShouldUseSeamlessTravel();
+	}
+
+	UE_LOG(LogSandboxTravel, Log, TEXT("Traveling to %s (%s)"), *MapPath, ShouldUseSeamlessTravel() ? TEXT("Seamless") : TEXT("Hard"));
+	return World->ServerTravel(MapPath + Options);
+}
+
+bool USandboxTravelSubsystem::ShouldUseSeamlessTravel() const {
+	const UWorld* World = GetGameInstance()->GetWorld();
+	return CVarSandboxSeamlessTravel.GetValueOnGameThread() && !(World && World->IsPlayInEditor());
+}
+
+
+/*--- Preload Functions ---*/
+
+void USandboxTravelSubsystem::PreloadMap(const FString& MapName) {
+	const FString ShortName = FPackageName::GetShortName(MapName);
+	if (ShortName == PreloadingMap && PreloadHandle.IsValid()) return;
+
+	// A Newly Picked Map Replaces the Last One's Preload
+	CancelPreload();
+
+	const FSandboxMapPreload* Preload = MapPreloads.FindByPredicate([&ShortName](const FSandboxMapPreload& Each) {
+		return Each.Map == ShortName;
+	});
+	if (!Preload || Preload->Assets.Num() == 0) return;
+
+	// The Assets Live in the Map's Chunks, Which May Not Be Mounted Yet
+	if (USandboxChunkSubsystem* Chunks = USandboxChunkSubsystem::Get()) Chunks->MountMapChunks(ShortName);
+
+	PreloadingMap = ShortName;
+	PreloadStartSeconds = FPlatformTime::Seconds();
+	PreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		Preload->Assets,
+		FStreamableDelegate::CreateUObject(this, &USandboxTravelSubsystem::OnPreloadComplete, ShortName),
+		FStreamableManager::AsyncLoadHighPriority,
+		false, // Manage Active Handle
+		false, // Start Stalled
+		FString::Printf(TEXT("SandboxPreload %s"), *ShortName)
+	);
+
+	UE_LOG(LogSandboxTravel, Log, TEXT("Preloading %d assets for %s"), Preload->Assets.Num(), *ShortName);
+}
+
+void USandboxTravelSubsystem::PreloadSessionMap(const FBlueprintSessionResult& Session) {
+	FString MapName;
+	if (Session.OnlineResult.Session.SessionSettings.Get(SETTING_MAPNAME, MapName)) PreloadMap(MapName);
+}
+
+void USandboxTravelSubsystem::CancelPreload() {
+	if (PreloadHandle.IsValid()) {
+		if (PreloadHandle->IsLoadingInProgress()) {
+			PreloadHandle->CancelHandle();
+		} else {
+			PreloadHandle->ReleaseHandle();
+		}
+	}
+
+	PreloadHandle.Reset();
+	PreloadingMap.Empty();
+}
+
+void USandboxTravelSubsystem::OnPreloadComplete(FString MapName) {
+	UE_LOG(LogSandboxTravel, Log, TEXT("Preloaded %s in %.2fs"), *MapName, FPlatformTime::Seconds() - PreloadStartSeconds);
+}
+
+
+/*--- Engine Hooks ---*/
+
+void USandboxTravelSubsystem::OnGameModeInitialized(AGameModeBase* GameMode) {
+	if (!GameMode || GameMode->GetGameInstance() != GetGameInstance()) return;
+
+	// Blueprint Game Modes Opt In Here, Rather Than in Each Asset
+	if (ShouldUseSeamlessTravel()) GameMode->bUseSeamlessTravel = true;
+}
+
+void USandboxTravelSubsystem::OnPostLoadMap(UWorld* LoadedWorld) {
+	if (!LoadedWorld || LoadedWorld->GetGameInstance() != GetGameInstance()) return;
+
+	const FString MapName = UWorld::RemovePIEPrefix(LoadedWorld->GetMapName());
+
+	// The Map's Actors Reference Its Assets Now, the Preload Has Done Its Job
+	if (MapName == PreloadingMap) {
+		UE_LOG(LogSandboxTravel, Log, TEXT("Entered %s %.2fs after its preload started"), *MapName, FPlatformTime::Seconds() - PreloadStartSeconds);
+		CancelPreload();
+	}
+
+	if (LoadedWorld->GetNetMode() == NM_ListenServer) AdvertiseMap(MapName);
+}
+
+void USandboxTravelSubsystem::OnJoinSessionComplete(FName SessionName, EOnJoinSessionCompleteResult::Type Result) {
+	if (Result != EOnJoinSessionCompleteResult::Success) return;
+
+	IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get();
+	IOnlineSessionPtr Sessions = OnlineSubsystem ? OnlineSubsystem->GetSessionInterface() : nullptr;
+	FOnlineSessionSettings* Settings = Sessions.IsValid() ? Sessions->GetSessionSettings(SessionName) : nullptr;
+
+	// Client Travel Starts Right After This, Whatever Is Already Queued Loads With the Map
+	FString MapName;
+	if (Settings && Settings->Get(SETTING_MAPNAME, MapName)) PreloadMap(MapName);
+}
+
+void USandboxTravelSubsystem::AdvertiseMap(const FString& MapName) const {
+	IOnlineSubsystem* OnlineSubsystem = IOnlineSubsystem::Get();
+	IOnlineSessionPtr Sessions = OnlineSubsystem ? OnlineSubsystem->GetSessionInterface() : nullptr;
+	FOnlineSessionSettings* Settings = Sessions.IsValid() ? Sessions->GetSessionSettings(NAME_GameSession) : nullptr;
+	if (!Settings) return;
+
+	FString AdvertisedMap;
+	if (Settings->Get(SETTING_MAPNAME, AdvertisedMap) && AdvertisedMap == MapName) return;
+
+	Settings->Set(SETTING_MAPNAME, MapName, EOnlineDataAdvertisementType::ViaOnlineService);
+	Sessions->UpdateSession(NAME_GameSession, *Settings, true);
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/StreamableManager.h"
+#include "FindSessionsCallbackProxy.h"
+#include "Interfaces/OnlineSessionInterface.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "UObject/SoftObjectPath.h"
+#include "SandboxTravelSubsystem.generated.h"
+
+class AGameModeBase;
+class UWorld;
+
+/*
+ *  SandboxTravelSubsystem.h                          Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxTravelSubsystem.cpp.
+ */
+
+// Assets Worth Loading Before a Map Is Entered (Config, DefaultGame.ini)
+USTRUCT()
+struct FSandboxMapPreload {
+	GENERATED_BODY()
+
+	// Short Map Name, e.g. FirstPersonMap
+	UPROPERTY()
+	FString Map;
+
+	UPROPERTY()
+	TArray<FSoftObjectPath> Assets;
+};
+
+UCLASS(Config=Game)
+class SANDBOX_API USandboxTravelSubsystem : public UGameInstanceSubsystem {
+
+	GENERATED_BODY()
+
+
+	/*--- Variables ---*/
+
+	private: UPROPERTY(Config) TArray<FSandboxMapPreload> MapPreloads;
+
+	// One Map's Assets Are Kept Loaded at a Time, Until That Map Is Entered
+	private: FString PreloadingMap;
+	private: TSharedPtr<FStreamableHandle> PreloadHandle;
+	private: double PreloadStartSeconds = 0.0;
+
+	private: FDelegateHandle GameModeInitializedHandle;
+	private: FDelegateHandle PostLoadMapHandle;
+	private: FDelegateHandle JoinSessionCompleteHandle;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+
+	public: virtual void Deinitialize() override;
+
+
+	/*--- Travel Functions ---*/
+
+	/** Preloads the map's heavy assets, then travels the server (and its clients) there, seamlessly when possible. **/
+	public: UFUNCTION(BlueprintCallable, Category=Travel)
+	bool TravelToMap(const FString& MapPath, const FString& Options = TEXT(""));
+
+	/** Whether server travel goes through the transition map (Never in PIE, Sandbox.Travel.Seamless 0 Disables). **/
+	public: bool ShouldUseSeamlessTravel() const;
+
+
+	/*--- Preload Functions ---*/
+
+	/** Starts loading a map's heavy assets at high priority. Call as soon as a map is selected. **/
+	public: UFUNCTION(BlueprintCallable, Category=Travel)
+	void PreloadMap(const FString& MapName);
+
+	/** Preloads the map a found session advertises, before it is joined. **/
+	public: UFUNCTION(BlueprintCallable, Category=Travel)
+	void PreloadSessionMap(const FBlueprintSessionResult& Session);
+
+	public: UFUNCTION(BlueprintCallable, Category=Travel)
+	void CancelPreload();
+
+	private: void OnPreloadComplete(FString MapName);
+
+
+	/*--- Engine Hooks ---*/
+
+	private: void OnGameModeInitialized(AGameModeBase* GameMode);
+
+	private: void OnPostLoadMap(UWorld* LoadedWorld);
+
+	private: void OnJoinSessionComplete(FName SessionName, EOnJoinSessionCompleteResult::Type Result);
+
+	/** Advertises the host's current map, so joining friends can preload it. **/
+	private: void AdvertiseMap(const FString& MapName) const;
+
+};
@@ -1,7 +1,12 @@
-
 #include "LogUtility.h"
 #include "Engine/GameEngine.h"
+#include "SandboxLog.h"
 
 void DebugLog(FString text) {
+	SANDBOX_LOG(Debug, "{0}", text);
+
+	// Untruncated On-Screen Copy, Development Builds Only
+#if !UE_BUILD_SHIPPING
 	if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 5.0f, FColor::White, text);
+#endif
 }
@@ -0,0 +1,374 @@
+
+#include "SandboxLog.h"
+#include "CoreGlobals.h"
+#include "Engine/Engine.h"
+#include "HAL/Event.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformProcess.h"
+#include "HAL/PlatformTLS.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/CommandLine.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+#include "Serialization/Archive.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSandboxLog, Log, All);
+
+/*
+ *  SandboxLog.cpp                                    Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxLog is a binary log cheap enough to leave on in shipping
+ *  builds. SANDBOX_LOG() copies a timestamp, its call site's format
+ *  ID and up to five raw arguments into a fixed 64 byte record in the
+ *  calling thread's own ring buffer. Nothing is formatted, allocated
+ *  or locked on the way in.
+ *
+ *    A writer thread drains every ring a few times a second into
+ *  Saved/Logs/Sandbox-<Time>.sblog, along with each call site's
+ *  format string and the text of any FName arguments the first time
+ *  they appear. Decode a log with:
+ *
+ *    UnrealEditor-Cmd Sandbox.uproject -run=SandboxLogDecode [-In=Path] [-Out=Path]
+ *
+ *  File Layout
+ *    - Header: Magic, Version, Seconds per Cycle, Start Cycles and
+ *      Start Time (UTC Ticks).
+ *    - Chunks, Each Led by a One Byte Tag:
+ *      F: Format ID, Category, Format, File, Line
+ *      N: Packed FName, Text
+ *      R: Thread ID, Count, Raw Records
+ *      D: Thread ID, Records Dropped So Far
+ *
+ *  Note: A full ring drops new records rather than block the caller.
+ *        Drops are counted and written to the log. A thread's ring is
+ *        freed once the thread exits and the ring has been drained.
+ *  Note: Development builds echo the categories listed in
+ *        Sandbox.Log.Echo on screen, formatted on the writer thread.
+ */
+
+
+/*--- Console Variables ---*/
+
+#if !UE_BUILD_SHIPPING
+static TAutoConsoleVariable<FString> CVarSandboxLogEcho(
+	TEXT("Sandbox.Log.Echo"),
+	TEXT("Input,Movement"),
+	TEXT("Comma separated SANDBOX_LOG categories to show on screen, or All.")
+);
+#endif
+
+
+/*--- Thread Buffers ---*/
+
+std::atomic<bool> FSandboxLog::IsLoggingFlag { false };
+
+// Owned by the Log, Which Frees It Once the Thread Has Exited and Every Record Is Written
+struct FSandboxLogThreadBuffer {
+	FSandboxLogBuffer* Buffer = nullptr;
+
+	~FSandboxLogThreadBuffer() {
+		if (Buffer) Buffer->IsOrphaned.store(true, std::memory_order_release);
+	}
+};
+
+static thread_local FSandboxLogThreadBuffer ThreadBuffer;
+
+
+/*--- Lifecycle Functions ---*/
+
+FSandboxLog& FSandboxLog::Get() {
+	static FSandboxLog Log;
+	return Log;
+}
+
+void FSandboxLog::Start() {
+	if (Thread || IsRunningCommandlet() || FParse::Param(FCommandLine::Get(), TEXT("NoSandboxLog"))) return;
+
+	FilePath = FPaths::Combine(FPaths::ProjectLogDir(), FString::Printf(TEXT("Sandbox-%s.sblog"), *FDateTime::Now().ToString()));
+	File = IFileManager::Get().CreateFileWriter(*FilePath, FILEWRITE_AllowRead);
+	if (!File) {
+		UE_LOG(LogSandboxLog, Warning, TEXT("Failed to open %s, SANDBOX_LOG is disabled"), *FilePath);
+		return;
+	}
+
+	uint32 Magic = FILE_MAGIC;
+	uint32 Version = FILE_VERSION;
+	double SecondsPerCycle = FPlatformTime::GetSecondsPerCycle64();
+	uint64 StartCycles = FPlatformTime::Cycles64();
+	int64 StartTicks = FDateTime::UtcNow().GetTicks();
+	*File << Magic << Version << SecondsPerCycle << StartCycles << StartTicks;
+
+	WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+	IsStopping = false;
+	IsLoggingFlag = true;
+	Thread = FRunnableThread::Create(this, TEXT("SandboxLogWriter"), 0, TPri_BelowNormal);
+
+#if !UE_BUILD_SHIPPING
+	EchoTickerHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FSandboxLog::TickEcho));
+#endif
+
+	UE_LOG(LogSandboxLog, Log, TEXT("Writing %s"), *FilePath);
+}
+
+void FSandboxLog::Shutdown() {
+	if (!Thread) return;
+
+	IsLoggingFlag = false;
+	FTSTicker::GetCoreTicker().RemoveTicker(EchoTickerHandle);
+
+	// Stops the Writer, Then Picks Up Whatever It Left Behind
+	Thread->Kill(true);
+	delete Thread;
+	Thread = nullptr;
+	Drain();
+
+	File->Close();
+	delete File;
+	File = nullptr;
+
+	FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+	WakeEvent = nullptr;
+}
+
+bool FSandboxLog::IsLogging() {
+	return IsLoggingFlag.load(std::memory_order_relaxed);
+}
+
+const FString& FSandboxLog::GetFilePath() const {
+	return FilePath;
+}
+
+
+/*--- Logging Functions ---*/
+
+uint16 FSandboxLog::RegisterFormat(const TCHAR* Category, const TCHAR* Format, const ANSICHAR* SourceFile, int32 Line) {
+	FScopeLock Lock(&FormatLock);
+	check(Formats.Num() < MAX_uint16);
+
+	FSandboxLogFormat& NewFormat = Formats.AddDefaulted_GetRef();
+	NewFormat.Category = Category;
+	NewFormat.Format = Format;
+	NewFormat.File = FPaths::GetCleanFilename(ANSI_TO_TCHAR(SourceFile));
+	NewFormat.Line = Line;
+
+	return (uint16) (Formats.Num() - 1);
+}
+
+FSandboxLogRecord* FSandboxLog::BeginRecord() {
+	if (!ThreadBuffer.Buffer) {
+		FSandboxLogBuffer* NewBuffer = new FSandboxLogBuffer();
+		NewBuffer->ThreadId = FPlatformTLS::GetCurrentThreadId();
+
+		FSandboxLog& Log = Get();
+		FScopeLock Lock(&Log.BufferLock);
+		Log.Buffers.Add(NewBuffer);
+		ThreadBuffer.Buffer = NewBuffer;
+	}
+
+	const uint64 Head = ThreadBuffer.Buffer->Head.load(std::memory_order_relaxed);
+	if (Head - ThreadBuffer.Buffer->Tail.load(std::memory_order_acquire) >= FSandboxLogBuffer::CAPACITY) {
+		ThreadBuffer.Buffer->Dropped.fetch_add(1, std::memory_order_relaxed);
+		return nullptr;
+	}
+
+	return &ThreadBuffer.Buffer->Records[Head % FSandboxLogBuffer::CAPACITY];
+}
+
+void FSandboxLog::CommitRecord() {
+	const uint64 Head = ThreadBuffer.Buffer->Head.load(std::memory_order_relaxed);
+	ThreadBuffer.Buffer->Head.store(Head + 1, std::memory_order_release);
+}
+
+void FSandboxLog::EncodeString(FSandboxLogRecord& Record, int32& Slot, const TCHAR* Text) {
+	Record.ArgTypes[Record.ArgCount++] = ESandboxLogArg::String;
+
+	// Truncated to the Remaining Slots, Never Mid-Character
+	FTCHARToUTF8 Utf8(Text ? Text : TEXT(""));
+	const int32 Capacity = (FSandboxLogRecord::ARG_SLOTS - Slot) * sizeof(uint64);
+	int32 Length = FMath::Min(Utf8.Length(), Capacity - 1);
+	while (Length > 0 && Length < Utf8.Length() && (Utf8.Get()[Length] & 0xC0) == 0x80) Length--;
+
+	ANSICHAR* Bytes = (ANSICHAR*) &Record.Args[Slot];
+	FMemory::Memcpy(Bytes, Utf8.Get(), Length);
+	Bytes[Length] = '\0';
+
+	Slot = FSandboxLogRecord::ARG_SLOTS;
+}
+
+FString FSandboxLog::FormatRecord(const FString& Format, const FSandboxLogRecord& Record, TFunctionRef<FString(uint64)> ResolveName) {
+	FStringFormatOrderedArguments Arguments;
+
+	int32 Slot = 0;
+	for (int32 Index = 0; Index < Record.ArgCount && Slot < FSandboxLogRecord::ARG_SLOTS; Index++, Slot++) {
+		const uint64 Value = Record.Args[Slot];
+
+		switch (Record.ArgTypes[Index]) {
+			case ESandboxLogArg::Int:
+				Arguments.Add((int64) Value);
+				break;
+			case ESandboxLogArg::UInt:
+				Arguments.Add(Value);
+				break;
+			case ESandboxLogArg::Double: {
+				double AsDouble;
+				FMemory::Memcpy(&AsDouble, &Value, sizeof(double));
+				Arguments.Add(AsDouble);
+				break;
+			}
+			case ESandboxLogArg::Bool:
+				Arguments.Add(Value ? TEXT("true") : TEXT("false"));
+				break;
+			case ESandboxLogArg::Name:
+				Arguments.Add(ResolveName(Value));
+				break;
+			case ESandboxLogArg::String:
+				Arguments.Add(FString(UTF8_TO_TCHAR((const ANSICHAR*) &Record.Args[Slot])));
+				Slot = FSandboxLogRecord::ARG_SLOTS;
+				break;
+			default:
+				Arguments.Add(TEXT("?"));
+				break;
+		}
+	}
+
+	return FString::Format(*Format, Arguments);
+}
+
+uint64 FSandboxLog::PackName(FName Name) {
+	return ((uint64) Name.GetDisplayIndex().ToUnstableInt() << 32) | (uint32) Name.GetNumber();
+}
+
+FName FSandboxLog::UnpackName(uint64 PackedName) {
+	const FNameEntryId EntryId = FNameEntryId::FromUnstableInt((uint32) (PackedName >> 32));
+	return FName(EntryId, EntryId, (int32) (uint32) PackedName);
+}
+
+
+/*--- Writer Functions ---*/
+
+uint32 FSandboxLog::Run() {
+	while (!IsStopping) {
+		WakeEvent->Wait(FTimespan::FromSeconds(DRAIN_INTERVAL));
+		Drain();
+	}
+
+	return 0;
+}
+
+void FSandboxLog::Stop() {
+	IsStopping = true;
+	if (WakeEvent) WakeEvent->Trigger();
+}
+
+void FSandboxLog::Drain() {
+	TArray<FSandboxLogBuffer*> BufferSnapshot;
+	{
+		FScopeLock Lock(&BufferLock);
+		BufferSnapshot = Buffers;
+	}
+
+#if !UE_BUILD_SHIPPING
+	TArray<FString> EchoCategories;
+	CVarSandboxLogEcho.GetValueOnAnyThread().ParseIntoArray(EchoCategories, TEXT(","));
+	const bool ShouldEchoAll = EchoCategories.Contains(TEXT("All"));
+#endif
+
+	for (FSandboxLogBuffer* Buffer : BufferSnapshot) {
+
+		// Read Before Head, So an Exited Thread's Last Records Are Drained Before Its Ring Is Freed
+		const bool IsOrphaned = Buffer->IsOrphaned.load(std::memory_order_acquire);
+		const uint64 Head = Buffer->Head.load(std::memory_order_acquire);
+		const uint64 Tail = Buffer->Tail.load(std::memory_order_relaxed);
+
+		if (Head != Tail) {
+			DrainedRecords.Reset();
+			for (uint64 Index = Tail; Index < Head; Index++) {
+				DrainedRecords.Add(Buffer->Records[Index % FSandboxLogBuffer::CAPACITY]);
+			}
+			Buffer->Tail.store(Head, std::memory_order_release);
+
+			// Every Drained Record's Call Site Has Registered by Now
+			WriteNewFormats();
+			for (const FSandboxLogRecord& Record : DrainedRecords) {
+				for (int32 Index = 0; Index < Record.ArgCount && Index < FSandboxLogRecord::ARG_SLOTS; Index++) {
+					if (Record.ArgTypes[Index] == ESandboxLogArg::Name) WriteName(Record.Args[Index]);
+				}
+			}
+
+			uint8 Tag = CHUNK_RECORDS;
+			uint32 ThreadId = Buffer->ThreadId;
+			int32 Count = DrainedRecords.Num();
+			*File << Tag << ThreadId << Count;
+			File->Serialize(DrainedRecords.GetData(), Count * sizeof(FSandboxLogRecord));
+
+#if !UE_BUILD_SHIPPING
+			if (ShouldEchoAll || EchoCategories.Num() > 0) {
+				FScopeLock Lock(&FormatLock);
+				for (const FSandboxLogRecord& Record : DrainedRecords) {
+					if (ShouldEchoAll || EchoCategories.Contains(Formats[Record.FormatId].Category)) EchoRecord(Record);
+				}
+			}
+#endif
+		}
+
+		const uint64 Dropped = Buffer->Dropped.load(std::memory_order_relaxed);
+		if (Dropped != Buffer->ReportedDropped) {
+			Buffer->ReportedDropped = Dropped;
+
+			uint8 Tag = CHUNK_DROPPED;
+			uint32 ThreadId = Buffer->ThreadId;
+			uint64 DroppedCount = Dropped;
+			*File << Tag << ThreadId << DroppedCount;
+		}
+
+		// Short Lived Workers Would Otherwise Leave Their Rings Behind
+		if (IsOrphaned) {
+			{
+				FScopeLock Lock(&BufferLock);
+				Buffers.RemoveSingleSwap(Buffer);
+			}
+			delete Buffer;
+		}
+	}
+
+	File->Flush();
+}
+
+void FSandboxLog::WriteNewFormats() {
+	FScopeLock Lock(&FormatLock);
+	for (; WrittenFormatCount < Formats.Num(); WrittenFormatCount++) {
+		FSandboxLogFormat& Format = Formats[WrittenFormatCount];
+
+		uint8 Tag = CHUNK_FORMAT;
+		uint16 FormatId = (uint16) WrittenFormatCount;
+		*File << Tag << FormatId << Format.Category << Format.Format << Format.File << Format.Line;
+	}
+}
+
+void FSandboxLog::WriteName(uint64 PackedName) {
+	bool IsAlreadyWritten = false;
+	WrittenNames.Add(PackedName, &IsAlreadyWritten);
+	if (IsAlreadyWritten) return;
+
+	uint8 Tag = CHUNK_NAME;
+	FString Text = UnpackName(PackedName).ToString();
+	*File << Tag << PackedName << Text;
+}
+
+void FSandboxLog::EchoRecord(const FSandboxLogRecord& Record) {
+	EchoQueue.Enqueue(FormatRecord(Formats[Record.FormatId].Format, Record, [](uint64 PackedName) {
+		return UnpackName(PackedName).ToString();
+	}));
+}
+
+bool FSandboxLog::TickEcho(float DeltaTime) {
+	FString Message;
+	while (EchoQueue.Dequeue(Message)) {
+		if (GEngine) GEngine->AddOnScreenDebugMessage(-1, 1.0f, FColor::White, Message);
+	}
+
+	return true;
+}
@@ -0,0 +1,244 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "HAL/Runnable.h"
+#include <atomic>
+#include <type_traits>
+
+class FArchive;
+class FEvent;
+class FRunnableThread;
+
+/*
+ *  SandboxLog.h                                      Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxLog.cpp.
+ */
+
+
+/*--- Macros ---*/
+
+// Format Must Be a Literal, Arguments Fill {0}, {1}, ... When Decoded (At Most 5, Strings Last)
+#define SANDBOX_LOG(Category, Format, ...)                                                                                      \
+	do {                                                                                                                        \
+		if (FSandboxLog::IsLogging()) {                                                                                         \
+			static const uint16 SandboxLogFormatId = FSandboxLog::Get().RegisterFormat(TEXT(#Category), TEXT(Format), __FILE__, __LINE__); \
+			FSandboxLog::Write(SandboxLogFormatId, ##__VA_ARGS__);                                                              \
+		}                                                                                                                       \
+	} while (0)
+
+
+/*--- Records ---*/
+
+enum class ESandboxLogArg : uint8 {
+	None,
+	Int,
+	UInt,
+	Double,
+	Bool,
+	Name,
+	String
+};
+
+// One Cache Line, Written As-Is to the Log File
+struct FSandboxLogRecord {
+	static constexpr int32 MAX_ARGS = 5;
+	static constexpr int32 ARG_SLOTS = 6;
+
+	uint64 Cycles = 0;
+	uint16 FormatId = 0;
+	uint8 ArgCount = 0;
+	ESandboxLogArg ArgTypes[MAX_ARGS] = {};
+	uint64 Args[ARG_SLOTS] = {};
+};
+static_assert(sizeof(FSandboxLogRecord) == 64, "Sandbox log records must stay one cache line");
+
+struct FSandboxLogFormat {
+	FString Category;
+	FString Format;
+	FString File;
+	int32 Line = 0;
+};
+
+// Single Producer (Owning Thread), Single Consumer (Writer Thread) Ring
+struct FSandboxLogBuffer {
+	static constexpr uint64 CAPACITY = 1024;
+
+	FSandboxLogRecord Records[CAPACITY];
+	std::atomic<uint64> Head { 0 };
+	std::atomic<uint64> Tail { 0 };
+	std::atomic<uint64> Dropped { 0 };
+	std::atomic<bool> IsOrphaned { false }; // Set Once the Owning Thread Exits
+	uint64 ReportedDropped = 0; // Writer Thread Only
+	uint32 ThreadId = 0;
+};
+
+
+/*--- Log ---*/
+
+class SANDBOX_API FSandboxLog : public FRunnable {
+
+
+	/*--- Constants ---*/
+
+	public: static constexpr uint32 FILE_MAGIC = 0x474C4253; // "SBLG"
+	public: static constexpr uint32 FILE_VERSION = 1;
+
+	// Chunk Tags
+	public: static constexpr uint8 CHUNK_FORMAT = 'F';
+	public: static constexpr uint8 CHUNK_NAME = 'N';
+	public: static constexpr uint8 CHUNK_RECORDS = 'R';
+	public: static constexpr uint8 CHUNK_DROPPED = 'D';
+
+	private: const float DRAIN_INTERVAL = 0.05f;
+
+
+	/*--- Variables ---*/
+
+	private: static std::atomic<bool> IsLoggingFlag;
+
+	// Call Sites, Indexed by Format ID
+	private: mutable FCriticalSection FormatLock;
+	private: TArray<FSandboxLogFormat> Formats;
+
+	private: FCriticalSection BufferLock;
+	private: TArray<FSandboxLogBuffer*> Buffers;
+
+	// Writer Thread State
+	private: FRunnableThread* Thread = nullptr;
+	private: FEvent* WakeEvent = nullptr;
+	private: std::atomic<bool> IsStopping { false };
+	private: FArchive* File = nullptr;
+	private: FString FilePath;
+	private: int32 WrittenFormatCount = 0;
+	private: TSet<uint64> WrittenNames;
+	private: TArray<FSandboxLogRecord> DrainedRecords;
+
+	// On-Screen Echo (Development Builds, Formatted on the Writer Thread)
+	private: TQueue<FString, EQueueMode::Spsc> EchoQueue;
+	private: FTSTicker::FDelegateHandle EchoTickerHandle;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: static FSandboxLog& Get();
+
+	/** Opens the log file and starts the writer thread. Called from the module's startup unless -NoSandboxLog. **/
+	public: void Start();
+
+	/** Writes everything still buffered and closes the file. **/
+	public: void Shutdown();
+
+	public: static bool IsLogging();
+
+	public: const FString& GetFilePath() const;
+
+
+	/*--- Logging Functions ---*/
+
+	/** Called once per SANDBOX_LOG call site. **/
+	public: uint16 RegisterFormat(const TCHAR* Category, const TCHAR* Format, const ANSICHAR* SourceFile, int32 Line);
+
+	public: template <typename... ArgTypes>
+	static void Write(uint16 FormatId, const ArgTypes&... Args);
+
+	/** Fills {0}, {1}, ... from a record's arguments. Shared by the echo and the decoder. **/
+	public: static FString FormatRecord(const FString& Format, const FSandboxLogRecord& Record, TFunctionRef<FString(uint64)> ResolveName);
+
+	public: static uint64 PackName(FName Name);
+
+	public: static FName UnpackName(uint64 PackedName);
+
+	// Returns a Slot in the Calling Thread's Buffer, or Null When Full (the Record Is Dropped)
+	private: static FSandboxLogRecord* BeginRecord();
+
+	private: static void CommitRecord();
+
+	private: template <typename ArgType>
+	static void EncodeArg(FSandboxLogRecord& Record, int32& Slot, const ArgType& Arg);
+
+	private: static void EncodeString(FSandboxLogRecord& Record, int32& Slot, const TCHAR* Text);
+
+
+	/*--- Writer Functions ---*/
+
+	private: virtual uint32 Run() override;
+
+	private: virtual void Stop() override;
+
+	private: void Drain();
+
+	private: void WriteNewFormats();
+
+	private: void WriteName(uint64 PackedName);
+
+	private: void EchoRecord(const FSandboxLogRecord& Record);
+
+	private: bool TickEcho(float DeltaTime);
+
+};
+
+
+/*--- Template Functions ---*/
+
+template <typename... ArgTypes>
+void FSandboxLog::Write(uint16 FormatId, const ArgTypes&... Args) {
+	static_assert(sizeof...(ArgTypes) <= FSandboxLogRecord::MAX_ARGS, "SANDBOX_LOG takes at most 5 arguments");
+
+	FSandboxLogRecord* Record = BeginRecord();
+	if (!Record) return;
+
+	Record->Cycles = FPlatformTime::Cycles64();
+	Record->FormatId = FormatId;
+	Record->ArgCount = 0;
+
+	int32 Slot = 0;
+	(EncodeArg(*Record, Slot, Args), ...);
+
+	CommitRecord();
+}
+
+template <typename ArgType>
+void FSandboxLog::EncodeArg(FSandboxLogRecord& Record, int32& Slot, const ArgType& Arg) {
+
+	// A String Fills Every Remaining Slot, Nothing Fits After It
+	if (Slot >= FSandboxLogRecord::ARG_SLOTS || Record.ArgCount >= FSandboxLogRecord::MAX_ARGS) return;
+
+	ESandboxLogArg& Type = Record.ArgTypes[Record.ArgCount];
+	uint64& Value = Record.Args[Slot];
+
+	if constexpr (std::is_same_v<ArgType, bool>) {
+		Type = ESandboxLogArg::Bool;
+		Value = Arg ? 1 : 0;
+	} else if constexpr (std::is_enum_v<ArgType>) {
+		Type = ESandboxLogArg::Int;
+		Value = (uint64) (int64) Arg;
+	} else if constexpr (std::is_integral_v<ArgType> && std::is_signed_v<ArgType>) {
+		Type = ESandboxLogArg::Int;
+		Value = (uint64) (int64) Arg;
+	} else if constexpr (std::is_integral_v<ArgType>) {
+		Type = ESandboxLogArg::UInt;
+		Value = (uint64) Arg;
+	} else if constexpr (std::is_floating_point_v<ArgType>) {
+		Type = ESandboxLogArg::Double;
+		const double AsDouble = (double) Arg;
+		FMemory::Memcpy(&Value, &AsDouble, sizeof(double));
+	} else if constexpr (std::is_same_v<ArgType, FName>) {
+		Type = ESandboxLogArg::Name;
+		Value = PackName(Arg);
+	} else if constexpr (std::is_same_v<ArgType, FString>) {
+		EncodeString(Record, Slot, *Arg);
+		return;
+	} else if constexpr (std::is_convertible_v<ArgType, const TCHAR*>) {
+		EncodeString(Record, Slot, Arg);
+		return;
+	} else {
+		static_assert(!sizeof(ArgType), "SANDBOX_LOG arguments must be numbers, bools, enums, FNames or strings");
+	}
+
+	Record.ArgCount++;
+	Slot++;
+}
@@ -0,0 +1,167 @@
+
+#include "SandboxLogDecodeCommandlet.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Parse.h"
+#include "Misc/Paths.h"
+#include "SandboxLog.h"
+#include "Serialization/Archive.h"
+#include "Templates/UniquePtr.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSandboxLogDecode, Log, All);
+
+/*
+ *  SandboxLogDecodeCommandlet.cpp                    Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxLogDecodeCommandlet turns a binary .sblog written by
+ *  SandboxLog into text, one line per record in time order across
+ *  every thread:
+ *
+ *    Seconds Since Start  [Thread]  Category  Message  (File:Line)
+ *
+ *    -In=Path picks the log (defaults to the newest one) and
+ *  -Out=Path the text file (defaults to the log's path as .txt).
+ *
+ *  Note: A log cut short by a crash decodes up to its last whole
+ *        chunk.
+ */
+
+struct FDecodedSandboxLogRecord {
+	uint32 ThreadId = 0;
+	FSandboxLogRecord Record;
+};
+
+
+/*--- Commandlet Functions ---*/
+
+int32 USandboxLogDecodeCommandlet::Main(const FString& Params) {
+	FString InPath;
+	if (!FParse::Value(*Params, TEXT("In="), InPath)) InPath = FindNewestLog();
+	if (InPath.IsEmpty()) {
+		UE_LOG(LogSandboxLogDecode, Error, TEXT("No log to decode, pass -In=Path"));
+		return 1;
+	}
+
+	FString OutPath;
+	if (!FParse::Value(*Params, TEXT("Out="), OutPath)) OutPath = FPaths::ChangeExtension(InPath, TEXT("txt"));
+
+	TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*InPath, FILEREAD_AllowWrite));
+	if (!Reader) {
+		UE_LOG(LogSandboxLogDecode, Error, TEXT("Failed to open %s"), *InPath);
+		return 1;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	double SecondsPerCycle = 0.0;
+	uint64 StartCycles = 0;
+	int64 StartTicks = 0;
+	*Reader << Magic << Version << SecondsPerCycle << StartCycles << StartTicks;
+	if (Magic != FSandboxLog::FILE_MAGIC || Version != FSandboxLog::FILE_VERSION) {
+		UE_LOG(LogSandboxLogDecode, Error, TEXT("%s is not a version %u Sandbox log"), *InPath, FSandboxLog::FILE_VERSION);
+		return 1;
+	}
+
+	// Read Every Chunk
+	TMap<uint16, FSandboxLogFormat> Formats;
+	TMap<uint64, FString> Names;
+	TMap<uint32, uint64> DroppedByThread;
+	TArray<FDecodedSandboxLogRecord> Records;
+
+	while (!Reader->AtEnd() && !Reader->IsError()) {
+		uint8 Tag = 0;
+		*Reader << Tag;
+
+		if (Tag == FSandboxLog::CHUNK_FORMAT) {
+			uint16 FormatId = 0;
+			FSandboxLogFormat Format;
+			*Reader << FormatId << Format.Category << Format.Format << Format.File << Format.Line;
+			Formats.Add(FormatId, MoveTemp(Format));
+		} else if (Tag == FSandboxLog::CHUNK_NAME) {
+			uint64 PackedName = 0;
+			FString Text;
+			*Reader << PackedName << Text;
+			Names.Add(PackedName, MoveTemp(Text));
+		} else if (Tag == FSandboxLog::CHUNK_RECORDS) {
+			uint32 ThreadId = 0;
+			int32 Count = 0;
+			*Reader << ThreadId << Count;
+			if (Count < 0 || Reader->Tell() + Count * (int64) sizeof(FSandboxLogRecord) > Reader->TotalSize()) break;
+
+			for (int32 Index = 0; Index < Count; Index++) {
+				FDecodedSandboxLogRecord& Decoded = Records.AddDefaulted_GetRef();
+				Decoded.ThreadId = ThreadId;
+				Reader->Serialize(&Decoded.Record, sizeof(FSandboxLogRecord));
+			}
+		} else if (Tag == FSandboxLog::CHUNK_DROPPED) {
+			uint32 ThreadId = 0;
+			uint64 DroppedCount = 0;
+			*Reader << ThreadId << DroppedCount;
+			DroppedByThread.Add(ThreadId, DroppedCount);
+		} else {
+			UE_LOG(LogSandboxLogDecode, Warning, TEXT("Unknown chunk '%c' at offset %lld, stopping"), (TCHAR) Tag, Reader->Tell() - 1);
+			break;
+		}
+	}
+
+	// Threads Were Drained Separately, Interleave Them by Time
+	Records.StableSort([](const FDecodedSandboxLogRecord& A, const FDecodedSandboxLogRecord& B) {
+		return A.Record.Cycles < B.Record.Cycles;
+	});
+
+	auto ResolveName = [&Names](uint64 PackedName) {
+		const FString* Text = Names.Find(PackedName);
+		return Text ? *Text : FString::Printf(TEXT("<Name %llx>"), PackedName);
+	};
+
+	FString Output = FString::Printf(TEXT("Sandbox log %s, started %s UTC\n"), *InPath, *FDateTime(StartTicks).ToString());
+	for (const FDecodedSandboxLogRecord& Decoded : Records) {
+		const double Seconds = (double) (int64) (Decoded.Record.Cycles - StartCycles) * SecondsPerCycle;
+		const FSandboxLogFormat* Format = Formats.Find(Decoded.Record.FormatId);
+
+		if (Format) {
+			Output += FString::Printf(
+				TEXT("%12.6f [%6u] %-10s %s (%s:%d)\n"),
+				Seconds,
+				Decoded.ThreadId,
+				*Format->Category,
+				*FSandboxLog::FormatRecord(Format->Format, Decoded.Record, ResolveName),
+				*Format->File,
+				Format->Line
+			);
+		} else {
+			Output += FString::Printf(TEXT("%12.6f [%6u] <Unknown Format %u>\n"), Seconds, Decoded.ThreadId, Decoded.Record.FormatId);
+		}
+	}
+
+	for (const TPair<uint32, uint64>& Dropped : DroppedByThread) {
+		Output += FString::Printf(TEXT("Thread %u dropped %llu records (buffer full)\n"), Dropped.Key, Dropped.Value);
+	}
+
+	if (!FFileHelper::SaveStringToFile(Output, *OutPath)) {
+		UE_LOG(LogSandboxLogDecode, Error, TEXT("Failed to write %s"), *OutPath);
+		return 1;
+	}
+
+	UE_LOG(LogSandboxLogDecode, Display, TEXT("Decoded %d records from %s to %s"), Records.Num(), *InPath, *OutPath);
+	return 0;
+}
+
+FString USandboxLogDecodeCommandlet::FindNewestLog() const {
+	TArray<FString> LogFiles;
+	IFileManager::Get().FindFiles(LogFiles, *FPaths::Combine(FPaths::ProjectLogDir(), TEXT("*.sblog")), true, false);
+
+	FString NewestPath;
+	FDateTime NewestTime = FDateTime::MinValue();
+	for (const FString& LogFile : LogFiles) {
+		const FString LogPath = FPaths::Combine(FPaths::ProjectLogDir(), LogFile);
+		const FDateTime Time = IFileManager::Get().GetTimeStamp(*LogPath);
+		if (Time > NewestTime) {
+			NewestTime = Time;
+			NewestPath = LogPath;
+		}
+	}
+
+	return NewestPath;
+}
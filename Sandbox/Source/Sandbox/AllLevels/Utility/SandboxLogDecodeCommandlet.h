@@ -0,0 +1,27 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "SandboxLogDecodeCommandlet.generated.h"
+
+/*
+ *  SandboxLogDecodeCommandlet.h                      Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxLogDecodeCommandlet.cpp.
+ */
+
+UCLASS()
+class SANDBOX_API USandboxLogDecodeCommandlet : public UCommandlet {
+
+	GENERATED_BODY()
+
+
+	/*--- Commandlet Functions ---*/
+
+	public: virtual int32 Main(const FString& Params) override;
+
+	/** Most recently written .sblog in the project's log directory. **/
+	private: FString FindNewestLog() const;
+
+};
@@ -0,0 +1,408 @@
+
+#include "SandboxMemory.h"
+#include "AdvancedSessions.h"
+#include "AdvancedSteamFriendsLibrary.h"
+#include "CoreGlobals.h"
+#include "Dom/JsonObject.h"
+#include "Engine/Engine.h"
+#include "Engine/Texture2D.h"
+#include "Engine/World.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/OutputDevice.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/Package.h"
+#include "UObject/UObjectArray.h"
+#include "UObject/UObjectGlobals.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSandboxMemory, Log, All);
+
+/*
+ *  SandboxMemory.cpp                                 Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxMemory tags the memory Sandbox systems allocate and
+ *  snapshots it after every map load, so growth across travel shows
+ *  up as a number rather than a soak test crash.
+ *
+ *  Low-Level Memory Tracker Tags (Launch With -llm)
+ *    - Sandbox/Input: Steam Input, input character setup & look.
+ *    - Sandbox/Grab: Grab components, traces & physics handles.
+ *    - Sandbox/Animation: Kinematic animation & instanced platforms.
+ *    - Sandbox/Sessions: Online login through the game instance.
+ *    - AdvancedSessions: Session proxies in the AdvancedSessions plugin.
+ *    - SteamAvatars: Friend avatar textures from AdvancedSteamSessions.
+ *
+ *    Each snapshot also records process memory, the UObject count and
+ *  transient textures, which work without -llm. When asked for, a
+ *  snapshot is taken SETTLE_FRAMES after each map load (following a
+ *  full GC) and diffed against the previous visit to the same map, so
+ *  StartMap -> LoadingMap -> gameplay and back is one round trip per
+ *  map. Without either flag below, and in Shipping builds, map loads
+ *  are left alone.
+ *
+ *    -SandboxMemory[=Path]           Snapshots loads, writes a JSON report at exit
+ *    -SandboxPerfMemory              Snapshots loads for the perf run's leak check
+ *    -SandboxMemoryRoundTrips=N      Round trips checked (Default: 3)
+ *    -SandboxMemoryLeakMB=X          Tag growth allowed (Default: 1)
+ *    Sandbox.Memory.Snapshot         Snapshots the current map now
+ *    Sandbox.Memory.Dump             Logs every diff & leak so far
+ *
+ *  Note: A metric is a leak when it grew on every one of the last N
+ *        returns to a map and by more than its threshold in total.
+ *        The first load of each map is never part of the window,
+ *        it fills caches that later visits reuse.
+ */
+
+
+/*--- Tags ---*/
+
+LLM_DEFINE_TAG(Sandbox);
+LLM_DEFINE_TAG(Sandbox_Input, TEXT("Input"), TEXT("Sandbox"));
+LLM_DEFINE_TAG(Sandbox_Grab, TEXT("Grab"), TEXT("Sandbox"));
+LLM_DEFINE_TAG(Sandbox_Animation, TEXT("Animation"), TEXT("Sandbox"));
+LLM_DEFINE_TAG(Sandbox_Sessions, TEXT("Sessions"), TEXT("Sandbox"));
+
+
+/*--- Metrics ---*/
+
+enum class ESandboxMemoryMetricKind : uint8 {
+	TagBytes,
+	ProcessBytes,
+	Count
+};
+
+struct FSandboxMemoryMetric {
+	FString Name;
+	ESandboxMemoryMetricKind Kind;
+	FName Tag; // Tag Metrics Only
+};
+
+static const TArray<FSandboxMemoryMetric>& GetMetrics() {
+	static const TArray<FSandboxMemoryMetric> Metrics = {
+		{ TEXT("UsedPhysical"), ESandboxMemoryMetricKind::ProcessBytes, NAME_None },
+		{ TEXT("UObjects"), ESandboxMemoryMetricKind::Count, NAME_None },
+		{ TEXT("TransientTextures"), ESandboxMemoryMetricKind::Count, NAME_None },
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+		{ TEXT("Sandbox/Input"), ESandboxMemoryMetricKind::TagBytes, LLM_TAG_NAME(Sandbox_Input) },
+		{ TEXT("Sandbox/Grab"), ESandboxMemoryMetricKind::TagBytes, LLM_TAG_NAME(Sandbox_Grab) },
+		{ TEXT("Sandbox/Animation"), ESandboxMemoryMetricKind::TagBytes, LLM_TAG_NAME(Sandbox_Animation) },
+		{ TEXT("Sandbox/Sessions"), ESandboxMemoryMetricKind::TagBytes, LLM_TAG_NAME(Sandbox_Sessions) },
+		{ TEXT("AdvancedSessions"), ESandboxMemoryMetricKind::TagBytes, LLM_TAG_NAME(AdvancedSessions) },
+		{ TEXT("SteamAvatars"), ESandboxMemoryMetricKind::TagBytes, LLM_TAG_NAME(SteamAvatars) },
+#endif
+	};
+	return Metrics;
+}
+
+static ESandboxMemoryMetricKind GetMetricKind(const FString& Name) {
+	const FSandboxMemoryMetric* Metric = GetMetrics().FindByPredicate([&Name](const FSandboxMemoryMetric& Each) { return Each.Name == Name; });
+	return Metric ? Metric->Kind : ESandboxMemoryMetricKind::Count;
+}
+
+// Changes Are Signed, Totals Aren't
+static FString FormatMetric(ESandboxMemoryMetricKind Kind, int64 Value, bool IsChange = true) {
+	if (Kind == ESandboxMemoryMetricKind::Count) return FString::Printf(IsChange ? TEXT("%+lld") : TEXT("%lld"), Value);
+	return FString::Printf(IsChange ? TEXT("%+.2f MB") : TEXT("%.2f MB"), Value / (1024.0 * 1024.0));
+}
+
+static bool IsLLMEnabled() {
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	return FLowLevelMemTracker::IsEnabled();
+#else
+	return false;
+#endif
+}
+
+
+/*--- Console Commands ---*/
+
+static FAutoConsoleCommandWithWorld SnapshotCommand(
+	TEXT("Sandbox.Memory.Snapshot"),
+	TEXT("Snapshots Sandbox memory now, under the current map."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World) {
+		FSandboxMemory::Get().TakeSnapshot(World ? UWorld::RemovePIEPrefix(World->GetMapName()) : FString());
+	})
+);
+
+static FAutoConsoleCommandWithOutputDevice DumpCommand(
+	TEXT("Sandbox.Memory.Dump"),
+	TEXT("Logs each Sandbox memory snapshot's change from the last visit to its map, then any leaks."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateLambda([](FOutputDevice& Output) {
+		FSandboxMemory::Get().Dump(Output);
+	})
+);
+
+
+/*--- Lifecycle Functions ---*/
+
+FSandboxMemory& FSandboxMemory::Get() {
+	static FSandboxMemory Memory;
+	return Memory;
+}
+
+void FSandboxMemory::Start() {
+	const TCHAR* CommandLine = FCommandLine::Get();
+	if (FParse::Value(CommandLine, TEXT("SandboxMemory="), ReportPath)) {
+		ShouldWriteReport = true;
+	} else if (FParse::Param(CommandLine, TEXT("SandboxMemory"))) {
+		ShouldWriteReport = true;
+		ReportPath = FPaths::Combine(
+			FPaths::ProfilingDir(),
+			TEXT("SandboxMemory"),
+			FString::Printf(TEXT("Memory-%s.json"), *FDateTime::Now().ToString())
+		);
+	}
+
+	RoundTrips = DEFAULT_ROUND_TRIPS;
+	TagThresholdMB = DEFAULT_TAG_THRESHOLD_MB;
+	FParse::Value(CommandLine, TEXT("SandboxMemoryRoundTrips="), RoundTrips);
+	FParse::Value(CommandLine, TEXT("SandboxMemoryLeakMB="), TagThresholdMB);
+	RoundTrips = FMath::Max(RoundTrips, 1);
+
+	// Each Snapshot Forces a Full GC After the Load, Players Never Pay for It
+#if !UE_BUILD_SHIPPING
+	if (!ShouldWriteReport && !FParse::Param(CommandLine, TEXT("SandboxPerfMemory"))) return;
+
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddRaw(this, &FSandboxMemory::OnPostLoadMap);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FSandboxMemory::OnEndFrame);
+	PreExitHandle = FCoreDelegates::OnPreExit.AddRaw(this, &FSandboxMemory::OnPreExit);
+#endif
+}
+
+void FSandboxMemory::Stop() {
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	FCoreDelegates::OnPreExit.Remove(PreExitHandle);
+}
+
+
+/*--- Snapshot Functions ---*/
+
+const FSandboxMemorySnapshot& FSandboxMemory::TakeSnapshot(const FString& Map) {
+	int32& VisitCount = VisitCounts.FindOrAdd(Map);
+
+	// Oldest Snapshots Go First, Leak Checks Only Look at the Last Few Visits
+	if (Snapshots.Num() >= MAX_SNAPSHOTS) Snapshots.RemoveAt(0);
+
+	FSandboxMemorySnapshot& Snapshot = Snapshots.AddDefaulted_GetRef();
+	Snapshot.Map = Map;
+	Snapshot.Visit = VisitCount++;
+	Snapshot.Seconds = FPlatformTime::Seconds() - GStartTime;
+	ReadMetrics(Snapshot.Values);
+
+	LogDiff(Snapshot);
+	return Snapshot;
+}
+
+const TArray<FSandboxMemorySnapshot>& FSandboxMemory::GetSnapshots() const {
+	return Snapshots;
+}
+
+const TArray<FString>& FSandboxMemory::GetMetricNames() {
+	static const TArray<FString> Names = [] {
+		TArray<FString> MetricNames;
+		for (const FSandboxMemoryMetric& Metric : GetMetrics()) MetricNames.Add(Metric.Name);
+		return MetricNames;
+	}();
+	return Names;
+}
+
+void FSandboxMemory::ReadMetrics(TArray<int64>& OutValues) {
+	const TArray<FSandboxMemoryMetric>& Metrics = GetMetrics();
+	OutValues.SetNumZeroed(Metrics.Num());
+
+	// Avatars & Other Runtime Textures Are Created in the Transient Package
+	int64 TransientTextures = 0;
+	for (TObjectIterator<UTexture2D> Texture; Texture; ++Texture) {
+		if (Texture->GetOuter() == GetTransientPackage()) TransientTextures++;
+	}
+
+	for (int32 Index = 0; Index < Metrics.Num(); Index++) {
+		const FSandboxMemoryMetric& Metric = Metrics[Index];
+
+		if (Metric.Name == TEXT("UsedPhysical")) {
+			OutValues[Index] = (int64) FPlatformMemory::GetStats().UsedPhysical;
+		} else if (Metric.Name == TEXT("UObjects")) {
+			OutValues[Index] = GUObjectArray.GetObjectArrayNumMinusAvailable();
+		} else if (Metric.Name == TEXT("TransientTextures")) {
+			OutValues[Index] = TransientTextures;
+		} else if (Metric.Kind == ESandboxMemoryMetricKind::TagBytes) {
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+			if (IsLLMEnabled()) OutValues[Index] = FLowLevelMemTracker::Get().GetTagAmountForTracker(ELLMTracker::Default, Metric.Tag, ELLMTagSet::None);
+#endif
+		}
+	}
+}
+
+
+/*--- Report Functions ---*/
+
+TArray<FSandboxMemoryLeak> FSandboxMemory::FindLeaks() const {
+	const TArray<FSandboxMemoryMetric>& Metrics = GetMetrics();
+	TArray<FSandboxMemoryLeak> Leaks;
+
+	for (const TPair<FString, int32>& Visits : VisitCounts) {
+
+		// Last RoundTrips + 1 Visits to This Map, Never the First
+		TArray<const FSandboxMemorySnapshot*> Window;
+		for (const FSandboxMemorySnapshot& Snapshot : Snapshots) {
+			if (Snapshot.Map == Visits.Key && Snapshot.Visit > 0 && Snapshot.Visit >= Visits.Value - RoundTrips - 1) Window.Add(&Snapshot);
+		}
+		if (Window.Num() < RoundTrips + 1) continue;
+
+		for (int32 Index = 0; Index < Metrics.Num(); Index++) {
+			bool DidGrowEveryTrip = true;
+			for (int32 Trip = 1; Trip < Window.Num() && DidGrowEveryTrip; Trip++) {
+				DidGrowEveryTrip = Window[Trip]->Values[Index] > Window[Trip - 1]->Values[Index];
+			}
+			if (!DidGrowEveryTrip) continue;
+
+			const int64 Growth = Window.Last()->Values[Index] - Window[0]->Values[Index];
+			const ESandboxMemoryMetricKind Kind = Metrics[Index].Kind;
+			const int64 Threshold =
+				Kind == ESandboxMemoryMetricKind::Count ? COUNT_THRESHOLD :
+				Kind == ESandboxMemoryMetricKind::ProcessBytes ? (int64) (PROCESS_THRESHOLD_MB * 1024.0 * 1024.0) :
+				(int64) (TagThresholdMB * 1024.0 * 1024.0);
+			if (Growth <= Threshold) continue;
+
+			FSandboxMemoryLeak& Leak = Leaks.AddDefaulted_GetRef();
+			Leak.Map = Visits.Key;
+			Leak.Metric = Metrics[Index].Name;
+			Leak.Growth = Growth;
+			Leak.RoundTrips = Window.Num() - 1;
+		}
+	}
+
+	return Leaks;
+}
+
+int32 FSandboxMemory::GetRoundTrips() const {
+	return RoundTrips;
+}
+
+void FSandboxMemory::Dump(FOutputDevice& Output) const {
+	const TArray<FSandboxMemoryMetric>& Metrics = GetMetrics();
+	Output.Logf(TEXT("Sandbox memory: %d snapshots, LLM %s"), Snapshots.Num(), IsLLMEnabled() ? TEXT("on") : TEXT("off (launch with -llm for tags)"));
+
+	for (int32 SnapshotIndex = 0; SnapshotIndex < Snapshots.Num(); SnapshotIndex++) {
+		const FSandboxMemorySnapshot& Snapshot = Snapshots[SnapshotIndex];
+
+		// Previous Visit to the Same Map
+		const FSandboxMemorySnapshot* Previous = nullptr;
+		for (int32 Index = SnapshotIndex - 1; Index >= 0 && !Previous; Index--) {
+			if (Snapshots[Index].Map == Snapshot.Map) Previous = &Snapshots[Index];
+		}
+
+		Output.Logf(TEXT("%9.3fs %s visit %d"), Snapshot.Seconds, *Snapshot.Map, Snapshot.Visit);
+		for (int32 Index = 0; Index < Metrics.Num(); Index++) {
+			Output.Logf(
+				TEXT("    %-20s %14s %14s"),
+				*Metrics[Index].Name,
+				*FormatMetric(Metrics[Index].Kind, Snapshot.Values[Index], false),
+				Previous ? *FormatMetric(Metrics[Index].Kind, Snapshot.Values[Index] - Previous->Values[Index]) : TEXT("")
+			);
+		}
+	}
+
+	for (const FSandboxMemoryLeak& Leak : FindLeaks()) {
+		Output.Logf(ELogVerbosity::Warning, TEXT("Leak: %s %s grew %s over %d round trips"), *Leak.Map, *Leak.Metric, *FormatMetric(GetMetricKind(Leak.Metric), Leak.Growth), Leak.RoundTrips);
+	}
+}
+
+void FSandboxMemory::LogDiff(const FSandboxMemorySnapshot& Snapshot) const {
+	const FSandboxMemorySnapshot* Previous = nullptr;
+	for (int32 Index = Snapshots.Num() - 1; Index >= 0 && !Previous; Index--) {
+		if (&Snapshots[Index] != &Snapshot && Snapshots[Index].Map == Snapshot.Map) Previous = &Snapshots[Index];
+	}
+
+	if (!Previous) {
+		UE_LOG(LogSandboxMemory, Log, TEXT("%s snapshot (first visit)"), *Snapshot.Map);
+		return;
+	}
+
+	const TArray<FSandboxMemoryMetric>& Metrics = GetMetrics();
+	FString Diff;
+	for (int32 Index = 0; Index < Metrics.Num(); Index++) {
+		const int64 Change = Snapshot.Values[Index] - Previous->Values[Index];
+		if (Change != 0) Diff += FString::Printf(TEXT(" %s %s,"), *Metrics[Index].Name, *FormatMetric(Metrics[Index].Kind, Change));
+	}
+	Diff.RemoveFromEnd(TEXT(","));
+
+	UE_LOG(LogSandboxMemory, Log, TEXT("%s visit %d vs %d:%s"), *Snapshot.Map, Snapshot.Visit, Previous->Visit, Diff.IsEmpty() ? TEXT(" unchanged") : *Diff);
+}
+
+void FSandboxMemory::WriteReport() const {
+	const TArray<FString>& MetricNames = GetMetricNames();
+
+	TSharedRef<FJsonObject> Report = MakeShared<FJsonObject>();
+	Report->SetStringField(TEXT("Platform"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+	Report->SetBoolField(TEXT("LLM"), IsLLMEnabled());
+	Report->SetNumberField(TEXT("RoundTrips"), RoundTrips);
+
+	TArray<TSharedPtr<FJsonValue>> SnapshotValues;
+	for (const FSandboxMemorySnapshot& Snapshot : Snapshots) {
+		TSharedRef<FJsonObject> SnapshotJson = MakeShared<FJsonObject>();
+		SnapshotJson->SetStringField(TEXT("Map"), Snapshot.Map);
+		SnapshotJson->SetNumberField(TEXT("Visit"), Snapshot.Visit);
+		SnapshotJson->SetNumberField(TEXT("Seconds"), Snapshot.Seconds);
+
+		TSharedRef<FJsonObject> ValuesJson = MakeShared<FJsonObject>();
+		for (int32 Index = 0; Index < MetricNames.Num(); Index++) ValuesJson->SetNumberField(MetricNames[Index], Snapshot.Values[Index]);
+		SnapshotJson->SetObjectField(TEXT("Values"), ValuesJson);
+
+		SnapshotValues.Add(MakeShared<FJsonValueObject>(SnapshotJson));
+	}
+	Report->SetArrayField(TEXT("Snapshots"), SnapshotValues);
+
+	TArray<TSharedPtr<FJsonValue>> LeakValues;
+	for (const FSandboxMemoryLeak& Leak : FindLeaks()) {
+		UE_LOG(LogSandboxMemory, Warning, TEXT("Leak: %s %s grew %s over %d round trips"), *Leak.Map, *Leak.Metric, *FormatMetric(GetMetricKind(Leak.Metric), Leak.Growth), Leak.RoundTrips);
+
+		TSharedRef<FJsonObject> LeakJson = MakeShared<FJsonObject>();
+		LeakJson->SetStringField(TEXT("Map"), Leak.Map);
+		LeakJson->SetStringField(TEXT("Metric"), Leak.Metric);
+		LeakJson->SetNumberField(TEXT("Growth"), Leak.Growth);
+		LeakJson->SetNumberField(TEXT("RoundTrips"), Leak.RoundTrips);
+		LeakValues.Add(MakeShared<FJsonValueObject>(LeakJson));
+	}
+	Report->SetArrayField(TEXT("Leaks"), LeakValues);
+
+	FString Json;
+	FJsonSerializer::Serialize(Report, TJsonWriterFactory<>::Create(&Json));
+
+	if (FFileHelper::SaveStringToFile(Json, *ReportPath)) {
+		UE_LOG(LogSandboxMemory, Log, TEXT("Memory report written to %s"), *ReportPath);
+	} else {
+		UE_LOG(LogSandboxMemory, Error, TEXT("Failed to write memory report to %s"), *ReportPath);
+	}
+}
+
+
+/*--- Engine Hooks ---*/
+
+void FSandboxMemory::OnPostLoadMap(UWorld* LoadedWorld) {
+	if (!LoadedWorld || !LoadedWorld->IsGameWorld()) return;
+
+	PendingMap = UWorld::RemovePIEPrefix(LoadedWorld->GetMapName());
+	FramesUntilSnapshot = SETTLE_FRAMES;
+
+	// Anything the Last Map Left Unreferenced Should Be Gone Before the Snapshot
+	if (GEngine) GEngine->ForceGarbageCollection(true);
+}
+
+void FSandboxMemory::OnEndFrame() {
+	if (FramesUntilSnapshot < 0 || FramesUntilSnapshot-- > 0) return;
+
+	TakeSnapshot(PendingMap);
+}
+
+void FSandboxMemory::OnPreExit() {
+	if (ShouldWriteReport) WriteReport();
+}
@@ -0,0 +1,126 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+class FOutputDevice;
+class UWorld;
+
+/*
+ *  SandboxMemory.h                                   Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxMemory.cpp.
+ */
+
+
+/*--- Tags ---*/
+
+// Low-Level Memory Tracker Tags (Shown Under Sandbox in stat LLM & Insights, Needs -llm)
+LLM_DECLARE_TAG_API(Sandbox, SANDBOX_API);
+LLM_DECLARE_TAG_API(Sandbox_Input, SANDBOX_API);
+LLM_DECLARE_TAG_API(Sandbox_Grab, SANDBOX_API);
+LLM_DECLARE_TAG_API(Sandbox_Animation, SANDBOX_API);
+LLM_DECLARE_TAG_API(Sandbox_Sessions, SANDBOX_API);
+
+
+/*--- Snapshots ---*/
+
+struct FSandboxMemorySnapshot {
+	FString Map;
+	int32 Visit = 0; // Times This Map Was Loaded Before
+	double Seconds = 0.0; // Since Process Launch
+
+	// Tracked Values (Parallel to FSandboxMemory::GetMetricNames), in Bytes or Counts
+	TArray<int64> Values;
+};
+
+struct FSandboxMemoryLeak {
+	FString Map;
+	FString Metric;
+	int64 Growth = 0; // Across the Checked Round Trips
+	int32 RoundTrips = 0;
+};
+
+class SANDBOX_API FSandboxMemory {
+
+
+	/*--- Constants ---*/
+
+	// Frames Between a Map Load & Its Snapshot, Lets Begin Play Allocations & the Post-Load GC Settle
+	private: const int32 SETTLE_FRAMES = 30;
+
+	private: const int32 DEFAULT_ROUND_TRIPS = 3;
+	private: const int32 MAX_SNAPSHOTS = 512;
+
+	// Growth Allowed Across the Checked Round Trips, per Kind of Metric (Process Memory Is Noisy)
+	private: const double DEFAULT_TAG_THRESHOLD_MB = 1.0;
+	private: const double PROCESS_THRESHOLD_MB = 32.0;
+	private: const int64 COUNT_THRESHOLD = 16;
+
+
+	/*--- Variables ---*/
+
+	private: TArray<FSandboxMemorySnapshot> Snapshots;
+	private: TMap<FString, int32> VisitCounts;
+
+	// Report Is Only Written When Asked For (-SandboxMemory[=Path])
+	private: bool ShouldWriteReport = false;
+	private: FString ReportPath;
+	private: int32 RoundTrips = 0;
+	private: double TagThresholdMB = 0.0;
+
+	private: FString PendingMap;
+	private: int32 FramesUntilSnapshot = -1;
+
+	private: FDelegateHandle PostLoadMapHandle;
+	private: FDelegateHandle EndFrameHandle;
+	private: FDelegateHandle PreExitHandle;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: static FSandboxMemory& Get();
+
+	/** Hooks map loads so each one is snapshotted once it settles, only when a memory flag is given (Never in Shipping). Called from the module's startup. **/
+	public: void Start();
+
+	public: void Stop();
+
+
+	/*--- Snapshot Functions ---*/
+
+	/** Records every tracked metric now, under the given map. **/
+	public: const FSandboxMemorySnapshot& TakeSnapshot(const FString& Map);
+
+	public: const TArray<FSandboxMemorySnapshot>& GetSnapshots() const;
+
+	public: static const TArray<FString>& GetMetricNames();
+
+	private: static void ReadMetrics(TArray<int64>& OutValues);
+
+
+	/*--- Report Functions ---*/
+
+	/** Metrics that grew on every return to a map across its last round trips, by more than the threshold. **/
+	public: TArray<FSandboxMemoryLeak> FindLeaks() const;
+
+	public: int32 GetRoundTrips() const;
+
+	/** Logs each snapshot's change from the previous visit to the same map, then any leaks. **/
+	public: void Dump(FOutputDevice& Output) const;
+
+	private: void LogDiff(const FSandboxMemorySnapshot& Snapshot) const;
+
+	private: void WriteReport() const;
+
+
+	/*--- Engine Hooks ---*/
+
+	private: void OnPostLoadMap(UWorld* LoadedWorld);
+
+	private: void OnEndFrame();
+
+	private: void OnPreExit();
+
+};
@@ -0,0 +1,145 @@
+
+#include "SandboxStats.h"
+#include "CoreGlobals.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/OutputDevice.h"
+#include <atomic>
+
+/*
+ *  SandboxStats.cpp                                  Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxStats puts every Sandbox gameplay system under one stats
+ *  group and one set of Unreal Insights scopes, so a single capture
+ *  shows which system is costing frame time:
+ *
+ *    stat Sandbox              Live cycle & counter stats
+ *    -trace=cpu                Sandbox<System> scopes in Insights
+ *    Sandbox.Stats.Dump        Per-system totals since the last reset
+ *    Sandbox.Stats.Reset       Starts a new measurement window
+ *
+ *    The dump's totals are kept separately from the stats system so
+ *  they also work in Test & Shipping builds. Each system's time is
+ *  self time: a system entered from inside another (Gamepad Look
+ *  from Input Character, Grab callbacks from Grab Trace) is charged
+ *  to itself, not both.
+ */
+
+
+/*--- Stats ---*/
+
+DEFINE_STAT(STAT_SandboxSteamInput);
+DEFINE_STAT(STAT_SandboxInput);
+DEFINE_STAT(STAT_SandboxGamepadLook);
+DEFINE_STAT(STAT_SandboxMovement);
+DEFINE_STAT(STAT_SandboxGrab);
+DEFINE_STAT(STAT_SandboxGrabTrace);
+DEFINE_STAT(STAT_SandboxKinematicAnimation);
+DEFINE_STAT(STAT_SandboxCharacterAnimation);
+DEFINE_STAT(STAT_SandboxBots);
+
+DEFINE_STAT(STAT_SandboxHeldObjects);
+DEFINE_STAT(STAT_SandboxGrabTraces);
+DEFINE_STAT(STAT_SandboxKinematicAnimators);
+DEFINE_STAT(STAT_SandboxBotCount);
+
+static const TCHAR* SystemNames[] = {
+	TEXT("Steam Input"),
+	TEXT("Input Character"),
+	TEXT("Gamepad Look"),
+	TEXT("Movement"),
+	TEXT("Grab"),
+	TEXT("Grab Trace"),
+	TEXT("Kinematic Animation"),
+	TEXT("Character Animation"),
+	TEXT("Bots")
+};
+static_assert(UE_ARRAY_COUNT(SystemNames) == (int32) ESandboxStatSystem::Count, "Every stat system needs a name");
+
+static std::atomic<uint64> SelfCycles[(int32) ESandboxStatSystem::Count];
+static std::atomic<uint64> Calls[(int32) ESandboxStatSystem::Count];
+
+// Measurement Window (Game Thread, Starts at Launch)
+static double WindowStartSeconds = 0.0;
+static uint64 WindowStartFrame = 0;
+
+// Innermost Open Scope on Each Thread
+static thread_local FSandboxStatScope* CurrentScope = nullptr;
+
+
+/*--- Console Commands ---*/
+
+static FAutoConsoleCommandWithOutputDevice DumpCommand(
+	TEXT("Sandbox.Stats.Dump"),
+	TEXT("Logs each Sandbox system's calls and self time since the last Sandbox.Stats.Reset."),
+	FConsoleCommandWithOutputDeviceDelegate::CreateStatic(&FSandboxStats::Dump)
+);
+
+static FAutoConsoleCommand ResetCommand(
+	TEXT("Sandbox.Stats.Reset"),
+	TEXT("Clears the totals reported by Sandbox.Stats.Dump."),
+	FConsoleCommandDelegate::CreateStatic(&FSandboxStats::Reset)
+);
+
+
+/*--- Scope Functions ---*/
+
+FSandboxStatScope::FSandboxStatScope(ESandboxStatSystem InSystem) : System(InSystem), Parent(CurrentScope) {
+	CurrentScope = this;
+	StartCycles = FPlatformTime::Cycles64();
+}
+
+FSandboxStatScope::~FSandboxStatScope() {
+	const uint64 ElapsedCycles = FPlatformTime::Cycles64() - StartCycles;
+	FSandboxStats::AddSelfCycles(System, ElapsedCycles > ChildCycles ? ElapsedCycles - ChildCycles : 0);
+
+	if (Parent) Parent->ChildCycles += ElapsedCycles;
+	CurrentScope = Parent;
+}
+
+
+/*--- Total Functions ---*/
+
+void FSandboxStats::AddSelfCycles(ESandboxStatSystem System, uint64 Cycles) {
+	SelfCycles[(int32) System].fetch_add(Cycles, std::memory_order_relaxed);
+	Calls[(int32) System].fetch_add(1, std::memory_order_relaxed);
+}
+
+void FSandboxStats::Dump(FOutputDevice& Output) {
+	const double WindowSeconds = FPlatformTime::Seconds() - (WindowStartSeconds > 0.0 ? WindowStartSeconds : GStartTime);
+	const uint64 WindowFrames = FMath::Max<uint64>(GFrameCounter - WindowStartFrame, 1);
+	const double FrameMs = WindowSeconds * 1000.0 / WindowFrames;
+
+	Output.Logf(TEXT("Sandbox stats over %.1fs, %llu frames (%.2fms average frame)"), WindowSeconds, WindowFrames, FrameMs);
+	Output.Logf(TEXT("%-20s %10s %10s %12s %10s %8s"), TEXT("System"), TEXT("Calls"), TEXT("Calls/f"), TEXT("Self ms"), TEXT("ms/f"), TEXT("Frame%"));
+
+	double TotalMsPerFrame = 0.0;
+	for (int32 Index = 0; Index < (int32) ESandboxStatSystem::Count; Index++) {
+		const uint64 SystemCalls = Calls[Index].load(std::memory_order_relaxed);
+		const double SelfMs = FPlatformTime::ToMilliseconds64(SelfCycles[Index].load(std::memory_order_relaxed));
+		const double MsPerFrame = SelfMs / WindowFrames;
+		TotalMsPerFrame += MsPerFrame;
+
+		Output.Logf(
+			TEXT("%-20s %10llu %10.1f %12.2f %10.3f %7.1f%%"),
+			SystemNames[Index],
+			SystemCalls,
+			(double) SystemCalls / WindowFrames,
+			SelfMs,
+			MsPerFrame,
+			FrameMs > 0.0 ? MsPerFrame / FrameMs * 100.0 : 0.0
+		);
+	}
+
+	Output.Logf(TEXT("%-20s %10s %10s %12s %10.3f %7.1f%%"), TEXT("Total"), TEXT(""), TEXT(""), TEXT(""), TotalMsPerFrame, FrameMs > 0.0 ? TotalMsPerFrame / FrameMs * 100.0 : 0.0);
+}
+
+void FSandboxStats::Reset() {
+	for (int32 Index = 0; Index < (int32) ESandboxStatSystem::Count; Index++) {
+		SelfCycles[Index].store(0, std::memory_order_relaxed);
+		Calls[Index].store(0, std::memory_order_relaxed);
+	}
+
+	WindowStartSeconds = FPlatformTime::Seconds();
+	WindowStartFrame = GFrameCounter;
+}
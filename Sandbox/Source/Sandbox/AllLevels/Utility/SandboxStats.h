@@ -0,0 +1,84 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Stats/Stats.h"
+
+/*
+ *  SandboxStats.h                                    Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxStats.cpp.
+ */
+
+
+/*--- Stats ---*/
+
+DECLARE_STATS_GROUP(TEXT("Sandbox"), STATGROUP_Sandbox, STATCAT_Advanced);
+
+// One Cycle Stat per System (Parallel to ESandboxStatSystem)
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Steam Input"), STAT_SandboxSteamInput, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Input Character"), STAT_SandboxInput, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Gamepad Look"), STAT_SandboxGamepadLook, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Movement"), STAT_SandboxMovement, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Grab"), STAT_SandboxGrab, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Grab Trace"), STAT_SandboxGrabTrace, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Kinematic Animation"), STAT_SandboxKinematicAnimation, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Character Animation"), STAT_SandboxCharacterAnimation, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Bots"), STAT_SandboxBots, STATGROUP_Sandbox, SANDBOX_API);
+
+// Per-Frame Counts
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Held Objects"), STAT_SandboxHeldObjects, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Grab Traces"), STAT_SandboxGrabTraces, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Kinematic Animators"), STAT_SandboxKinematicAnimators, STATGROUP_Sandbox, SANDBOX_API);
+DECLARE_DWORD_COUNTER_STAT_EXTERN(TEXT("Bots"), STAT_SandboxBotCount, STATGROUP_Sandbox, SANDBOX_API);
+
+enum class ESandboxStatSystem : uint8 {
+	SteamInput,
+	Input,
+	GamepadLook,
+	Movement,
+	Grab,
+	GrabTrace,
+	KinematicAnimation,
+	CharacterAnimation,
+	Bots,
+	Count
+};
+
+
+/*--- Macros ---*/
+
+// Top-Level Entry Into a System: Cycle Stat, Insights Scope & the Sandbox.Stats.Dump Totals
+#define SANDBOX_SCOPE(System)                                  \
+	SCOPE_CYCLE_COUNTER(STAT_Sandbox##System);                 \
+	TRACE_CPUPROFILER_EVENT_SCOPE(Sandbox##System);            \
+	FSandboxStatScope ANONYMOUS_VARIABLE(SandboxStatScope)(ESandboxStatSystem::System)
+
+
+/*--- Totals ---*/
+
+// Times Its Scope, Minus Any Nested System Scopes on the Same Thread (Self Time)
+class SANDBOX_API FSandboxStatScope {
+
+	private: ESandboxStatSystem System;
+	private: uint64 StartCycles = 0;
+	private: uint64 ChildCycles = 0;
+	private: FSandboxStatScope* Parent = nullptr;
+
+	public: explicit FSandboxStatScope(ESandboxStatSystem InSystem);
+
+	public: ~FSandboxStatScope();
+
+};
+
+class SANDBOX_API FSandboxStats {
+
+	public: static void AddSelfCycles(ESandboxStatSystem System, uint64 Cycles);
+
+	/** Logs each system's calls and self time since the last reset. **/
+	public: static void Dump(FOutputDevice& Output);
+
+	public: static void Reset();
+
+};
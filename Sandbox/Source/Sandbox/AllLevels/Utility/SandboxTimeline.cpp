@@ -0,0 +1,209 @@
+
+#include "SandboxTimeline.h"
+#include "CoreGlobals.h"
+#include "Dom/JsonObject.h"
+#include "Misc/App.h"
+#include "Misc/CommandLine.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "ProfilingDebugging/MiscTrace.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+#include "UObject/UObjectGlobals.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSandboxTimeline, Log, All);
+
+/*
+ *  SandboxTimeline.cpp                               Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    SandboxTimeline records when the game reaches each startup and
+ *  travel milestone, measured from process launch:
+ *
+ *    ModuleStartup, EngineInit, StartGameInstance, StartupComplete,
+ *    MapLoadStart, MapLoadEnd, WorldBeginPlay, FirstTick, FirstFrame
+ *    and Exit.
+ *
+ *    Every milestone becomes an Unreal Insights bookmark, and each
+ *  map load a timing region, so a trace (-trace=default) shows them
+ *  against the CPU timeline. Launching with -SandboxTimeline (or
+ *  -SandboxTimeline=Path.json) also writes a JSON summary, with time
+ *  from each map load start to its later milestones, and a CSV of
+ *  the raw events at exit.
+ *
+ *  Note: FirstFrame is the end of the first engine frame after a
+ *        load, which includes enqueuing its rendering. Under
+ *        -nullrhi it marks the first full game frame instead.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+FSandboxTimeline& FSandboxTimeline::Get() {
+	static FSandboxTimeline Timeline;
+	return Timeline;
+}
+
+void FSandboxTimeline::Start() {
+	const TCHAR* CommandLine = FCommandLine::Get();
+	if (FParse::Value(CommandLine, TEXT("SandboxTimeline="), SummaryPath)) {
+		ShouldWriteSummary = true;
+	} else if (FParse::Param(CommandLine, TEXT("SandboxTimeline"))) {
+		ShouldWriteSummary = true;
+		SummaryPath = FPaths::Combine(
+			FPaths::ProfilingDir(),
+			TEXT("SandboxTimeline"),
+			FString::Printf(TEXT("Timeline-%s.json"), *FDateTime::Now().ToString())
+		);
+	}
+
+	PostEngineInitHandle = FCoreDelegates::OnPostEngineInit.AddRaw(this, &FSandboxTimeline::OnPostEngineInit);
+	PreLoadMapHandle = FCoreUObjectDelegates::PreLoadMap.AddRaw(this, &FSandboxTimeline::OnPreLoadMap);
+	PostLoadMapHandle = FCoreUObjectDelegates::PostLoadMapWithWorld.AddRaw(this, &FSandboxTimeline::OnPostLoadMap);
+	PostWorldInitializationHandle = FWorldDelegates::OnPostWorldInitialization.AddRaw(this, &FSandboxTimeline::OnPostWorldInitialization);
+	WorldTickStartHandle = FWorldDelegates::OnWorldTickStart.AddRaw(this, &FSandboxTimeline::OnWorldTickStart);
+	EndFrameHandle = FCoreDelegates::OnEndFrame.AddRaw(this, &FSandboxTimeline::OnEndFrame);
+	PreExitHandle = FCoreDelegates::OnPreExit.AddRaw(this, &FSandboxTimeline::OnPreExit);
+
+	Mark(TEXT("ModuleStartup"));
+}
+
+void FSandboxTimeline::Stop() {
+	FCoreDelegates::OnPostEngineInit.Remove(PostEngineInitHandle);
+	FCoreUObjectDelegates::PreLoadMap.Remove(PreLoadMapHandle);
+	FCoreUObjectDelegates::PostLoadMapWithWorld.Remove(PostLoadMapHandle);
+	FWorldDelegates::OnPostWorldInitialization.Remove(PostWorldInitializationHandle);
+	FWorldDelegates::OnWorldTickStart.Remove(WorldTickStartHandle);
+	FCoreDelegates::OnEndFrame.Remove(EndFrameHandle);
+	FCoreDelegates::OnPreExit.Remove(PreExitHandle);
+}
+
+
+/*--- Timeline Functions ---*/
+
+void FSandboxTimeline::Mark(const FString& Name, const FString& Map) {
+	FSandboxTimelineEvent& Event = Events.AddDefaulted_GetRef();
+	Event.Name = Name;
+	Event.Map = Map;
+	Event.Seconds = FPlatformTime::Seconds() - GStartTime;
+
+	TRACE_BOOKMARK(TEXT("Sandbox %s %s"), *Name, *Map);
+	UE_LOG(LogSandboxTimeline, Log, TEXT("%9.3fs %s %s"), Event.Seconds, *Name, *Map);
+}
+
+const TArray<FSandboxTimelineEvent>& FSandboxTimeline::GetEvents() const {
+	return Events;
+}
+
+
+/*--- Engine Hooks ---*/
+
+void FSandboxTimeline::OnPostEngineInit() {
+	Mark(TEXT("EngineInit"));
+}
+
+void FSandboxTimeline::OnPreLoadMap(const FString& MapUrl) {
+	LoadingMap = FPackageName::GetShortName(MapUrl);
+	Mark(TEXT("MapLoadStart"), LoadingMap);
+
+	LoadRegionName = TEXT("Sandbox Load ") + LoadingMap;
+	TRACE_BEGIN_REGION(*LoadRegionName);
+}
+
+void FSandboxTimeline::OnPostLoadMap(UWorld* LoadedWorld) {
+	if (LoadedWorld) LoadingMap = UWorld::RemovePIEPrefix(LoadedWorld->GetMapName());
+	Mark(TEXT("MapLoadEnd"), LoadingMap);
+
+	if (!LoadRegionName.IsEmpty()) {
+		TRACE_END_REGION(*LoadRegionName);
+		LoadRegionName.Empty();
+	}
+
+	IsWaitingForFirstTick = true;
+	IsWaitingForFirstFrame = true;
+}
+
+void FSandboxTimeline::OnPostWorldInitialization(UWorld* World, const UWorld::InitializationValues InitializationValues) {
+
+	// Bound Here Because Loaded Maps Begin Play Before PostLoadMap Fires
+	if (World && World->IsGameWorld()) {
+		World->OnWorldBeginPlay.AddRaw(this, &FSandboxTimeline::OnWorldBeginPlay, UWorld::RemovePIEPrefix(World->GetMapName()));
+	}
+}
+
+void FSandboxTimeline::OnWorldBeginPlay(FString MapName) {
+	Mark(TEXT("WorldBeginPlay"), MapName);
+}
+
+void FSandboxTimeline::OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds) {
+	if (!IsWaitingForFirstTick || !World || !World->IsGameWorld()) return;
+
+	IsWaitingForFirstTick = false;
+	Mark(TEXT("FirstTick"), LoadingMap);
+}
+
+void FSandboxTimeline::OnEndFrame() {
+	if (!IsWaitingForFirstFrame || IsWaitingForFirstTick) return;
+
+	IsWaitingForFirstFrame = false;
+	Mark(TEXT("FirstFrame"), LoadingMap);
+}
+
+void FSandboxTimeline::OnPreExit() {
+	Mark(TEXT("Exit"));
+	if (ShouldWriteSummary) WriteSummary();
+}
+
+
+/*--- Summary Functions ---*/
+
+void FSandboxTimeline::WriteSummary() const {
+	TSharedRef<FJsonObject> Summary = MakeShared<FJsonObject>();
+	Summary->SetStringField(TEXT("Platform"), ANSI_TO_TCHAR(FPlatformProperties::IniPlatformName()));
+	Summary->SetStringField(TEXT("Configuration"), LexToString(FApp::GetBuildConfiguration()));
+	Summary->SetStringField(TEXT("Build"), FApp::GetBuildVersion());
+
+	FString Csv = TEXT("Seconds,Name,Map\n");
+	TArray<TSharedPtr<FJsonValue>> EventValues;
+	for (const FSandboxTimelineEvent& Event : Events) {
+		TSharedRef<FJsonObject> EventJson = MakeShared<FJsonObject>();
+		EventJson->SetStringField(TEXT("Name"), Event.Name);
+		EventJson->SetStringField(TEXT("Map"), Event.Map);
+		EventJson->SetNumberField(TEXT("Seconds"), Event.Seconds);
+		EventValues.Add(MakeShared<FJsonValueObject>(EventJson));
+
+		Csv += FString::Printf(TEXT("%.4f,%s,%s\n"), Event.Seconds, *Event.Name, *Event.Map);
+	}
+	Summary->SetArrayField(TEXT("Events"), EventValues);
+
+	// Each Map Load & the Milestones That Followed It, Relative to Its Start
+	TArray<TSharedPtr<FJsonValue>> Transitions;
+	for (int32 Index = 0; Index < Events.Num(); Index++) {
+		const FSandboxTimelineEvent& LoadStart = Events[Index];
+		if (LoadStart.Name != TEXT("MapLoadStart")) continue;
+
+		TSharedRef<FJsonObject> Transition = MakeShared<FJsonObject>();
+		Transition->SetStringField(TEXT("Map"), LoadStart.Map);
+		Transition->SetNumberField(TEXT("StartSeconds"), LoadStart.Seconds);
+
+		for (int32 Next = Index + 1; Next < Events.Num() && Events[Next].Name != TEXT("MapLoadStart"); Next++) {
+			const FSandboxTimelineEvent& Event = Events[Next];
+			if (!Transition->HasField(Event.Name)) Transition->SetNumberField(Event.Name, Event.Seconds - LoadStart.Seconds);
+		}
+
+		Transitions.Add(MakeShared<FJsonValueObject>(Transition));
+	}
+	Summary->SetArrayField(TEXT("Transitions"), Transitions);
+
+	FString Json;
+	FJsonSerializer::Serialize(Summary, TJsonWriterFactory<>::Create(&Json));
+
+	const FString CsvPath = FPaths::ChangeExtension(SummaryPath, TEXT("csv"));
+	if (FFileHelper::SaveStringToFile(Json, *SummaryPath) && FFileHelper::SaveStringToFile(Csv, *CsvPath)) {
+		UE_LOG(LogSandboxTimeline, Log, TEXT("Timeline written to %s"), *SummaryPath);
+	} else {
+		UE_LOG(LogSandboxTimeline, Error, TEXT("Failed to write timeline to %s"), *SummaryPath);
+	}
+}
@@ -0,0 +1,87 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineBaseTypes.h"
+#include "Engine/World.h"
+
+/*
+ *  SandboxTimeline.h                                 Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for SandboxTimeline.cpp.
+ */
+
+struct FSandboxTimelineEvent {
+	FString Name;
+	FString Map;
+	double Seconds = 0.0; // Since Process Launch
+};
+
+class SANDBOX_API FSandboxTimeline {
+
+
+	/*--- Variables ---*/
+
+	private: TArray<FSandboxTimelineEvent> Events;
+
+	// Summary Is Only Written When Asked For (-SandboxTimeline[=Path])
+	private: bool ShouldWriteSummary = false;
+	private: FString SummaryPath;
+
+	// First Tick & Frame After Each Map Load
+	private: FString LoadingMap;
+	private: FString LoadRegionName;
+	private: bool IsWaitingForFirstTick = false;
+	private: bool IsWaitingForFirstFrame = false;
+
+	private: FDelegateHandle PostEngineInitHandle;
+	private: FDelegateHandle PreLoadMapHandle;
+	private: FDelegateHandle PostLoadMapHandle;
+	private: FDelegateHandle PostWorldInitializationHandle;
+	private: FDelegateHandle WorldTickStartHandle;
+	private: FDelegateHandle EndFrameHandle;
+	private: FDelegateHandle PreExitHandle;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: static FSandboxTimeline& Get();
+
+	/** Hooks engine init, map loads and frames. Called from the module's startup. **/
+	public: void Start();
+
+	public: void Stop();
+
+
+	/*--- Timeline Functions ---*/
+
+	/** Records a named moment, both here and as an Unreal Insights bookmark. **/
+	public: void Mark(const FString& Name, const FString& Map = FString());
+
+	public: const TArray<FSandboxTimelineEvent>& GetEvents() const;
+
+
+	/*--- Engine Hooks ---*/
+
+	private: void OnPostEngineInit();
+
+	private: void OnPreLoadMap(const FString& MapUrl);
+
+	private: void OnPostLoadMap(UWorld* LoadedWorld);
+
+	private: void OnPostWorldInitialization(UWorld* World, const UWorld::InitializationValues InitializationValues);
+
+	private: void OnWorldBeginPlay(FString MapName);
+
+	private: void OnWorldTickStart(UWorld* World, ELevelTick TickType, float DeltaSeconds);
+
+	private: void OnEndFrame();
+
+	private: void OnPreExit();
+
+
+	/*--- Summary Functions ---*/
+
+	private: void WriteSummary() const;
+
+};
@@ -1,6 +1,8 @@
 
 #include "SteamInputComponent.h"
 #include "AllLevels/Input/GamepadType.h"
+#include "AllLevels/Utility/SandboxMemory.h"
+#include "AllLevels/Utility/SandboxStats.h"
 #include <iostream>
 #include <string>
 
@@ -25,6 +27,10 @@
 /*--- Lifecycle Functions ---*/
 
 void USteamInputComponent::OnTick(float DeltaTime) {
+	SANDBOX_SCOPE(SteamInput);
+	LLM_SCOPE_BYTAG(Sandbox_Input);
+
+#if WITH_SANDBOX_STEAM
 	if (IsSteamInputAvailable()) {
 		CheckForConnectedControllers(); // Checks for Connected Controllers
 		SteamInput()->RunFrame(); // Queries Steam for Updated Inputs
@@ -66,6 +72,7 @@ void USteamInputComponent::OnTick(float DeltaTime) {
 
 		}
 	}
+#endif
 }
 
 
@@ -213,7 +220,10 @@ void USteamInputComponent::BindControllerDisconnect(UObject * InUserObject, cons
 
 /*--- Steam API Functions ---*/
 
+#if WITH_SANDBOX_STEAM
+
 void USteamInputComponent::SetupSteamInput() {
+	LLM_SCOPE_BYTAG(Sandbox_Input);
 
 	InitializeSteamInput();
 	if (IsSteamInputAvailable()) {
@@ -239,8 +249,7 @@ void USteamInputComponent::CheckForConnectedControllers() {
 	// Activate Sandbox Action Set
 	SandboxSetHandle = SteamInput()->GetActionSetHandle("SandboxControls");
 
-	// Get List of Connected Controllers
-	controllers = new InputHandle_t[STEAM_INPUT_MAX_COUNT];
+	// Get List of Connected Controllers (Into the Member Array, Nothing Is Allocated per Frame)
 	SteamInput()->GetConnectedControllers(controllers);
 
 	if (controllers[0]) {
@@ -299,17 +308,40 @@ EGamepadType USteamInputComponent::GetFirstConnectedGamepadType() {
 	return EGamepadType::Disconnected;
 }
 
-InputDigitalActionData_t USteamInputComponent::GetDigitalInput(char* name) {
+InputDigitalActionData_t USteamInputComponent::GetDigitalInput(const char* name) {
 	return SteamInput()->GetDigitalActionData(controllers[0], SteamInput()->GetDigitalActionHandle(name));
 }
 
-InputAnalogActionData_t USteamInputComponent::GetAnalogInput(char* name) {
+InputAnalogActionData_t USteamInputComponent::GetAnalogInput(const char* name) {
 	return SteamInput()->GetAnalogActionData(controllers[0], SteamInput()->GetAnalogActionHandle(name));
 }
 
+#else
+
+// Stub Backend (No Steam Client Library in This Build)
+void USteamInputComponent::SetupSteamInput() {
+	InitializeSteamInput();
+}
+
+void USteamInputComponent::InitializeSteamInput() {
+	IsSteamInputInitialized = false;
+}
+
+bool USteamInputComponent::IsSteamInputAvailable() {
+	return false;
+}
+
+EGamepadType USteamInputComponent::GetFirstConnectedGamepadType() {
+	return EGamepadType::Disconnected;
+}
+
+#endif
+
 
 /*--- Input Delegation Functions ---*/
 
+#if WITH_SANDBOX_STEAM
+
 void USteamInputComponent::DelegateButtonInput(
 		InputDigitalActionData_t Action,
 		bool &IsPressed,
@@ -335,4 +367,6 @@ void USteamInputComponent::DelegateStickInput(InputAnalogActionData_t Action, Ve
 
 void USteamInputComponent::DelegateYInvertedStickInput(InputAnalogActionData_t Action, VectorInputDelegate Delegate) {
 	if (Delegate.IsBound()) Delegate.Execute(FVector2D(Action.x, -Action.y));
-}
\ No newline at end of file
+}
+
+#endif
@@ -1,10 +1,11 @@
 
 #pragma once
 
-#pragma warning(push)
-#pragma warning(disable: 4996)
+#if WITH_SANDBOX_STEAM
+THIRD_PARTY_INCLUDES_START
 #include "Dependencies/Steam/Library/steam_api.h"
-#pragma warning(pop)
+THIRD_PARTY_INCLUDES_END
+#endif
 #include "AllLevels/Input/GamepadType.h"
 #include "SteamInputComponentDelegates.h"
 #include "SteamInputComponent.generated.h"
@@ -142,16 +143,23 @@ class USteamInputComponent : public UObject {
 	/*--- Steam API ---*/
 
 	/** Whether SteamInput is properly initialized */
-	private: bool IsSteamInputInitialized;
+	private: bool IsSteamInputInitialized = false;
 
-	/** List of connected steam controllers **/
-	private: InputHandle_t *controllers;
+	/* Note: Builds without the Steam client library (dedicated servers, Linux
+	 *       without libsteam_api.so) get a stub backend that never reports
+	 *       SteamInput as available, so characters fall back to Unreal input.
+	 */
+
+#if WITH_SANDBOX_STEAM
+	/** List of connected steam controllers, refilled every frame **/
+	private: InputHandle_t controllers[STEAM_INPUT_MAX_COUNT] = {};
 
 	/** Whether controller was previously connected **/
 	private: bool WasControllerConnected = false;
 
 	/** Sandbox Action Set Handle **/
 	private: InputActionSetHandle_t SandboxSetHandle;
+#endif
 
 	/** Prepares SteamInput library for use - to be called from BeginPlay() **/
 	public: void SetupSteamInput();
@@ -162,21 +170,26 @@ class USteamInputComponent : public UObject {
 	/** Checks SteamInput initialization state & whether class returns null */
 	public: bool IsSteamInputAvailable();
 
+#if WITH_SANDBOX_STEAM
 	/** Checks for Connected Controllers **/
 	private: void CheckForConnectedControllers();
+#endif
 
 	/** Determine type of first connected controller **/
 	public: EGamepadType GetFirstConnectedGamepadType(); 
 
+#if WITH_SANDBOX_STEAM
 	/** Utility Method - Gets Digital Action Data from SteamInput **/
-	private: InputDigitalActionData_t GetDigitalInput(char* name);
+	private: InputDigitalActionData_t GetDigitalInput(const char* name);
 
 	/** Utility Method - Gets Analog Action Data from SteamInput **/
-	private: InputAnalogActionData_t GetAnalogInput(char* name);
+	private: InputAnalogActionData_t GetAnalogInput(const char* name);
+#endif
 
 
 	/*--- Input Delegation Functions ---*/
 
+#if WITH_SANDBOX_STEAM
 	private: void DelegateButtonInput(
 		InputDigitalActionData_t Action,
 		bool &IsPressed,
@@ -189,6 +202,7 @@ class USteamInputComponent : public UObject {
 	private: void DelegateStickInput(InputAnalogActionData_t Action, VectorInputDelegate Delegate);
 
 	private: void DelegateYInvertedStickInput(InputAnalogActionData_t Action, VectorInputDelegate Delegate);
+#endif
 
 };
 
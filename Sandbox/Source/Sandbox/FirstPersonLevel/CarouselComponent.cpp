@@ -1,4 +1,8 @@
 #include "FirstPersonLevel/CarouselComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "FirstPersonLevel/KinematicAnimationSubsystem.h"
 
 /*
  *  CarouselComponent.cpp                            Chris Cruzen
@@ -6,37 +10,51 @@
  *
  *    CarouselComponent runs a looping spin animation on whatever
  *  object the component is attached to.
+ *
+ *  Note: The component doesn't tick. It registers its object with
+ *        KinematicAnimationSubsystem, which animates every carousel
+ *        in the world as one batch.
  */
 
 
 /*--- Lifecycle Functions ---*/
 
 UCarouselComponent::UCarouselComponent() {
-	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UCarouselComponent::BeginPlay() {
 	Super::BeginPlay();
+
+	// Every Machine Evaluates the Same Pose, So Nothing Needs Replicating
+	if (GetOwner()->GetIsReplicated() && GetOwner()->HasAuthority()) {
+		GetOwner()->SetReplicateMovement(false);
+		GetOwner()->SetNetDormancy(DORM_DormantAll);
+	}
+
+	UPrimitiveComponent *OwnerPrimitiveComponent = GetOwner()->FindComponentByClass<UPrimitiveComponent>();
+	UKinematicAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UKinematicAnimationSubsystem>();
+	if (OwnerPrimitiveComponent && AnimationSubsystem) {
+		AnimationSubsystem->RegisterCarousel(this, OwnerPrimitiveComponent);
+	}
 }
 
-void UCarouselComponent::TickComponent(
-	float DeltaTime,
-	ELevelTick TickType,
-	FActorComponentTickFunction* ThisTickFunction
-) {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
-	ElapsedTime += DeltaTime;
+void UCarouselComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+	UKinematicAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UKinematicAnimationSubsystem>();
+	if (AnimationSubsystem) AnimationSubsystem->UnregisterCarousel(this);
 
-	UPrimitiveComponent *OwnerPrimitiveComponent = Cast<UPrimitiveComponent>(
-		GetOwner()->GetComponentByClass(UPrimitiveComponent::StaticClass())
-	);
+	Super::EndPlay(EndPlayReason);
+}
 
-	OwnerPrimitiveComponent->SetWorldRotation(
-		FRotator(
-			0.0f,
-			0.0f + ElapsedTime * SpinSpeed,
-			0.0f
-		)
+
+/*--- Animation Functions ---*/
+
+FRotator UCarouselComponent::EvaluateRotation(float SpinSpeed, double AnimationTime) {
+
+	// Wrap in Double Precision So Long Sessions Don't Lose Angle Resolution
+	return FRotator(
+		0.0,
+		FMath::Fmod(AnimationTime * SpinSpeed, 360.0),
+		0.0
 	);
 }
-
@@ -18,7 +18,10 @@ class SANDBOX_API UCarouselComponent : public UActorComponent {
 
 public: UPROPERTY(EditInstanceOnly, BlueprintReadWrite, Category=Gameplay) float SpinSpeed = 7.0f;
 
-private: float ElapsedTime = 0.0f;
+/** Moves the body through physics kinematic targets instead of teleporting the component, so
+ *  riders and stacked props pick up its velocity. Read when play begins.
+ */
+public: UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category=Physics) bool UseKinematicTarget = false;
 
 
 /*--- Lifecycle Functions ---*/
@@ -27,10 +30,14 @@ public:	UCarouselComponent();
 
 protected: virtual void BeginPlay() override;
 
-public:	virtual void TickComponent(
-	float DeltaTime,
-	ELevelTick TickType,
-	FActorComponentTickFunction* ThisTickFunction
-) override;
+protected: virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+
+/*--- Animation Functions ---*/
+
+/** Spin pose at AnimationTime seconds, in closed form so every machine agrees. Pure, so it can
+ *  be evaluated off the game thread.
+ */
+public: static FRotator EvaluateRotation(float SpinSpeed, double AnimationTime);
 
 };
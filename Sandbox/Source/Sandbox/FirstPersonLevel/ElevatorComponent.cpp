@@ -1,5 +1,9 @@
 
 #include "FirstPersonLevel/ElevatorComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "FirstPersonLevel/KinematicAnimationSubsystem.h"
 #include "GenericPlatform/GenericPlatformMath.h"
 
 /*
@@ -8,40 +12,60 @@
  *
  *    ElevatorComponent runs a looping rise/fall animation on whatever
  *  object the component is attached to.
+ *
+ *  Note: The component doesn't tick. It registers its object with
+ *        KinematicAnimationSubsystem, which animates every elevator
+ *        in the world as one batch.
  */
 
 
 /*--- Lifecycle Functions ---*/
 
 UElevatorComponent::UElevatorComponent() {
-	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bCanEverTick = false;
 }
 
 void UElevatorComponent::BeginPlay() {
 	Super::BeginPlay();
+
+	// Every Machine Evaluates the Same Pose, So Nothing Needs Replicating
+	if (GetOwner()->GetIsReplicated() && GetOwner()->HasAuthority()) {
+		GetOwner()->SetReplicateMovement(false);
+		GetOwner()->SetNetDormancy(DORM_DormantAll);
+	}
+
+	UPrimitiveComponent *OwnerPrimitiveComponent = GetOwner()->FindComponentByClass<UPrimitiveComponent>();
+	UKinematicAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UKinematicAnimationSubsystem>();
+	if (OwnerPrimitiveComponent && AnimationSubsystem) {
+		AnimationSubsystem->RegisterElevator(this, OwnerPrimitiveComponent);
+	}
 }
 
-void UElevatorComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) {
-	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+void UElevatorComponent::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+	UKinematicAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UKinematicAnimationSubsystem>();
+	if (AnimationSubsystem) AnimationSubsystem->UnregisterElevator(this);
 
-	ElapsedTime += DeltaTime;
-	float Progress = FGenericPlatformMath::Fmod(ElapsedTime, CycleTime * 1000.0f) / CycleTime;
-	if (!CycleUpward) { Progress = 1.0f - Progress; }
+	Super::EndPlay(EndPlayReason);
+}
 
-	UPrimitiveComponent *OwnerPrimitiveComponent = Cast<UPrimitiveComponent>(
-		GetOwner()->GetComponentByClass(UPrimitiveComponent::StaticClass())
-	);
 
-	if (StartLocation == FVector()) {
-		StartLocation = OwnerPrimitiveComponent->GetComponentLocation();
-	}
+/*--- Animation Functions ---*/
+
+FVector UElevatorComponent::EvaluateLocation(
+	const FVector& StartLocation,
+	float CycleTime,
+	float CycleHeight,
+	bool CycleUpward,
+	double AnimationTime
+) {
 
-	OwnerPrimitiveComponent->SetWorldLocation(
-		FVector(
-			StartLocation.X,
-			StartLocation.Y,
-			StartLocation.Z + (FMath::Sin((20.0f * Progress)/ 3.14159265f) / 2.0f + 0.5f) * CycleHeight
-		)
+	// Wrap the Phase in Double Precision, Then Take the Sine
+	double Angle = FGenericPlatformMath::Fmod(20.0 * AnimationTime / (CycleTime * UE_DOUBLE_PI), 2.0 * UE_DOUBLE_PI);
+	if (!CycleUpward) { Angle = 20.0 / UE_DOUBLE_PI - Angle; }
+
+	return FVector(
+		StartLocation.X,
+		StartLocation.Y,
+		StartLocation.Z + (FMath::Sin(Angle) / 2.0 + 0.5) * CycleHeight
 	);
 }
-
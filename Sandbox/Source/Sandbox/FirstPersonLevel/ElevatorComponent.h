@@ -23,9 +23,10 @@ public: UPROPERTY(EditInstanceOnly, BlueprintReadWrite, Category=Gameplay) float
 
 public: UPROPERTY(EditInstanceOnly, BlueprintReadWrite, Category=Gameplay) bool CycleUpward = true;
 
-private: float ElapsedTime = 0.0f;
-
-private: FVector StartLocation = FVector();
+/** Moves the body through physics kinematic targets instead of teleporting the component, so
+ *  riders and stacked props pick up its velocity. Read when play begins.
+ */
+public: UPROPERTY(EditInstanceOnly, BlueprintReadOnly, Category=Physics) bool UseKinematicTarget = false;
 
 
 /*--- Lifecycle Methods ---*/
@@ -34,10 +35,20 @@ public:	UElevatorComponent();
 
 protected: virtual void BeginPlay() override;
 
-public:	virtual void TickComponent(
-	float DeltaTime,
-	ELevelTick TickType,
-	FActorComponentTickFunction* ThisTickFunction
-) override;
-		
+protected: virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+
+/*--- Animation Methods ---*/
+
+/** Elevator location at AnimationTime seconds, in closed form so every machine agrees. Pure, so
+ *  it can be evaluated off the game thread.
+ */
+public: static FVector EvaluateLocation(
+	const FVector& StartLocation,
+	float CycleTime,
+	float CycleHeight,
+	bool CycleUpward,
+	double AnimationTime
+);
+
 };
@@ -0,0 +1,118 @@
+
+#include "FirstPersonLevel/InstancedPlatformActor.h"
+#include "AllLevels/Utility/SandboxMemory.h"
+#include "Async/ParallelFor.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/World.h"
+#include "FirstPersonLevel/CarouselComponent.h"
+#include "FirstPersonLevel/ElevatorComponent.h"
+#include "FirstPersonLevel/KinematicAnimationSubsystem.h"
+
+/*
+ *  InstancedPlatformActor.cpp                        Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    InstancedPlatformActor draws any number of spinning and rising
+ *  platforms as instances of a single instanced mesh. Each instance
+ *  carries its own carousel or elevator parameters and is animated
+ *  with the same math as the standalone components, so a course of
+ *  thousands of moving pieces costs one actor, one draw setup and
+ *  one batched transform update per frame.
+ *
+ *  Note: The actor doesn't tick. KinematicAnimationSubsystem calls
+ *        UpdateInstances at the rate its significance allows. The
+ *        mesh isn't hierarchical, since every instance moves each
+ *        update and a cluster tree would be rebuilt every time.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+AInstancedPlatformActor::AInstancedPlatformActor() {
+	PrimaryActorTick.bCanEverTick = false;
+
+	InstancedMesh = CreateDefaultSubobject<UInstancedStaticMeshComponent>(TEXT("InstancedMesh"));
+	InstancedMesh->SetMobility(EComponentMobility::Movable);
+	InstancedMesh->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	RootComponent = InstancedMesh;
+}
+
+void AInstancedPlatformActor::OnConstruction(const FTransform& Transform) {
+	Super::OnConstruction(Transform);
+	RebuildInstances();
+}
+
+void AInstancedPlatformActor::BeginPlay() {
+	Super::BeginPlay();
+
+	// Placed Actors in Cooked Levels Skip OnConstruction, So the Instances Are Rebuilt Here
+	RebuildInstances();
+
+	UKinematicAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UKinematicAnimationSubsystem>();
+	if (AnimationSubsystem && Platforms.Num() > 0) {
+		AnimationSubsystem->RegisterInstancedPlatform(this);
+	}
+}
+
+void AInstancedPlatformActor::EndPlay(const EEndPlayReason::Type EndPlayReason) {
+	UKinematicAnimationSubsystem* AnimationSubsystem = GetWorld()->GetSubsystem<UKinematicAnimationSubsystem>();
+	if (AnimationSubsystem) AnimationSubsystem->UnregisterInstancedPlatform(this);
+
+	Super::EndPlay(EndPlayReason);
+}
+
+
+/*--- Animation Functions ---*/
+
+void AInstancedPlatformActor::UpdateInstances(double AnimationTime) {
+	if (InstanceTransforms.Num() != Platforms.Num()) return;
+
+	// Evaluate Every Instance Across Worker Threads
+	ParallelFor(
+		Platforms.Num(),
+		[this, AnimationTime](int32 Index) {
+			const FInstancedPlatform& Platform = Platforms[Index];
+			FTransform& InstanceTransform = InstanceTransforms[Index];
+
+			if (Platform.Motion == EPlatformMotion::Carousel) {
+				const FQuat Spin = UCarouselComponent::EvaluateRotation(Platform.SpinSpeed, AnimationTime).Quaternion();
+				InstanceTransform.SetRotation(Spin * Platform.Transform.GetRotation());
+			}
+			else {
+				InstanceTransform.SetLocation(
+					UElevatorComponent::EvaluateLocation(
+						Platform.Transform.GetLocation(),
+						Platform.CycleTime,
+						Platform.CycleHeight,
+						Platform.CycleUpward,
+						AnimationTime
+					)
+				);
+			}
+		},
+		Platforms.Num() < MIN_INSTANCES_PER_WORKER ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None
+	);
+
+	// Push Render Data and Instance Bodies Together
+	InstancedMesh->BatchUpdateInstancesTransforms(
+		0,
+		InstanceTransforms,
+		false, // Whether Transforms Are in World Space
+		true,  // Whether to Mark Render State Dirty
+		false  // Whether to Teleport Instance Bodies
+	);
+}
+
+void AInstancedPlatformActor::RebuildInstances() {
+	LLM_SCOPE_BYTAG(Sandbox_Animation);
+
+	InstancedMesh->ClearInstances();
+	InstanceTransforms.Reset(Platforms.Num());
+
+	for (const FInstancedPlatform& Platform : Platforms) {
+		InstanceTransforms.Add(Platform.Transform);
+	}
+
+	InstancedMesh->AddInstances(InstanceTransforms, false);
+}
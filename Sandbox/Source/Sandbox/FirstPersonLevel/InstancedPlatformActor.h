@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "InstancedPlatformActor.generated.h"
+
+class UInstancedStaticMeshComponent;
+
+/*
+ *  InstancedPlatformActor.h                          Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for InstancedPlatformActor.cpp.
+ */
+
+UENUM(BlueprintType)
+enum class EPlatformMotion : uint8 {
+	Carousel    UMETA(DisplayName = "Carousel"),
+	Elevator    UMETA(DisplayName = "Elevator")
+};
+
+USTRUCT(BlueprintType)
+struct FInstancedPlatform {
+	GENERATED_BODY()
+
+	// Rest Pose Relative to the Actor
+	UPROPERTY(EditAnywhere, meta=(MakeEditWidget=true))
+	FTransform Transform;
+
+	UPROPERTY(EditAnywhere)
+	EPlatformMotion Motion = EPlatformMotion::Carousel;
+
+	UPROPERTY(EditAnywhere, meta=(EditCondition="Motion == EPlatformMotion::Carousel", EditConditionHides))
+	float SpinSpeed = 7.0f;
+
+	UPROPERTY(EditAnywhere, meta=(EditCondition="Motion == EPlatformMotion::Elevator", EditConditionHides))
+	float CycleTime = 30.0f;
+
+	UPROPERTY(EditAnywhere, meta=(EditCondition="Motion == EPlatformMotion::Elevator", EditConditionHides))
+	float CycleHeight = 200.0f;
+
+	UPROPERTY(EditAnywhere, meta=(EditCondition="Motion == EPlatformMotion::Elevator", EditConditionHides))
+	bool CycleUpward = true;
+};
+
+UCLASS()
+class SANDBOX_API AInstancedPlatformActor : public AActor {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	// Below this many instances, worker dispatch costs more than it saves.
+	private: const int32 MIN_INSTANCES_PER_WORKER = 256;
+
+
+	/*--- Variables ---*/
+
+	public: UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category=Platforms)
+	UInstancedStaticMeshComponent* InstancedMesh = nullptr;
+
+	public: UPROPERTY(EditAnywhere, Category=Platforms)
+	TArray<FInstancedPlatform> Platforms;
+
+	// Derived From Platforms (Not Saved, Cooked Levels Don't Rerun Construction)
+	private: TArray<FTransform> InstanceTransforms;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: AInstancedPlatformActor();
+
+	public: virtual void OnConstruction(const FTransform& Transform) override;
+
+	protected: virtual void BeginPlay() override;
+
+	protected: virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+
+	/*--- Animation Functions ---*/
+
+	/** Evaluates every platform at AnimationTime with the carousel and elevator math, then pushes
+	 *  all instance transforms (and their collision) in one batch.
+	 */
+	public: void UpdateInstances(double AnimationTime);
+
+	private: void RebuildInstances();
+
+};
@@ -0,0 +1,405 @@
+
+#include "FirstPersonLevel/KinematicAnimationSubsystem.h"
+#include "Async/ParallelFor.h"
+#include "PhysicsEngine/BodyInstance.h"
+#include "Components/PrimitiveComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/GameStateBase.h"
+#include "GameFramework/PlayerController.h"
+#include "SignificanceManager.h"
+#include "FirstPersonLevel/CarouselComponent.h"
+#include "AllLevels/Utility/SandboxMemory.h"
+#include "AllLevels/Utility/SandboxStats.h"
+#include "FirstPersonLevel/ElevatorComponent.h"
+#include "FirstPersonLevel/InstancedPlatformActor.h"
+
+/*
+ *  KinematicAnimationSubsystem.cpp                   Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    KinematicAnimationSubsystem drives every looping carousel and
+ *  elevator in the world. Animator parameters live in contiguous
+ *  arrays, so each frame is one parallel pass over plain data to
+ *  evaluate poses, followed by one game thread pass that pushes the
+ *  results onto cached primitives.
+ *
+ *    Poses are evaluated in closed form from replicated server
+ *  time rather than integrated frame by frame, so every machine
+ *  computes the same pose without any per-frame replication and the
+ *  animated actors can stay net dormant.
+ *
+ *    Each animator is scored by the significance manager from
+ *  distance to the nearest viewpoint, whether it was recently
+ *  rendered, and whether a character is standing on it. Low scores
+ *  update every few frames or not at all, and since poses are closed
+ *  form, an animator that picks back up lands exactly where it
+ *  should be.
+ *
+ *    Instanced platform actors register as a single unit and
+ *  animate all of their instances in one batched update.
+ *
+ *    Animators flagged UseKinematicTarget skip component movement
+ *  altogether. Their pose is handed to the physics body as a kinematic
+ *  target and the component follows the simulated body, so anything
+ *  resting on the platform is carried with a real velocity.
+ *
+ *  Note: Component transforms can only be written on the game
+ *        thread, so only the evaluation step runs on workers.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+void UKinematicAnimationSubsystem::Tick(float DeltaTime) {
+	if (Carousels.Num() == 0 && Elevators.Num() == 0 && InstancedPlatforms.Num() == 0) return;
+	SANDBOX_SCOPE(KinematicAnimation);
+	LLM_SCOPE_BYTAG(Sandbox_Animation);
+	INC_DWORD_STAT_BY(STAT_SandboxKinematicAnimators, Carousels.Num() + Elevators.Num() + InstancedPlatforms.Num());
+
+	const double AnimationTime = GetAnimationTime();
+	UpdateSignificance();
+	RefreshAnimatorParameters();
+	EvaluateAnimators(AnimationTime, DeltaTime);
+	ApplyAnimators();
+	UpdateInstancedPlatforms(AnimationTime);
+}
+
+TStatId UKinematicAnimationSubsystem::GetStatId() const {
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UKinematicAnimationSubsystem, STATGROUP_Tickables);
+}
+
+void UKinematicAnimationSubsystem::Deinitialize() {
+	for (UCarouselComponent* Carousel : Carousels) UnregisterSignificance(Carousel);
+	for (UElevatorComponent* Elevator : Elevators) UnregisterSignificance(Elevator);
+	for (AInstancedPlatformActor* InstancedPlatform : InstancedPlatforms) UnregisterSignificance(InstancedPlatform);
+
+	Carousels.Empty();
+	CarouselPrimitives.Empty();
+	CarouselSpinSpeeds.Empty();
+	CarouselRotations.Empty();
+	CarouselUpdateIntervals.Empty();
+	CarouselUseKinematicTarget.Empty();
+
+	Elevators.Empty();
+	ElevatorPrimitives.Empty();
+	ElevatorCycleTimes.Empty();
+	ElevatorCycleHeights.Empty();
+	ElevatorCycleUpward.Empty();
+	ElevatorStartLocations.Empty();
+	ElevatorLocations.Empty();
+	ElevatorUpdateIntervals.Empty();
+	ElevatorUseKinematicTarget.Empty();
+
+	InstancedPlatforms.Empty();
+	InstancedPlatformUpdateIntervals.Empty();
+
+	RiddenPrimitives.Empty();
+	Viewpoints.Empty();
+
+	Super::Deinitialize();
+}
+
+bool UKinematicAnimationSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const {
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+
+/*--- Registration Functions ---*/
+
+void UKinematicAnimationSubsystem::RegisterCarousel(UCarouselComponent* Carousel, UPrimitiveComponent* Primitive) {
+	LLM_SCOPE_BYTAG(Sandbox_Animation);
+	if (!Carousel || !Primitive || Carousels.Contains(Carousel)) return;
+
+	Carousels.Add(Carousel);
+	CarouselPrimitives.Add(Primitive);
+	CarouselSpinSpeeds.Add(Carousel->SpinSpeed);
+	CarouselRotations.Add(Primitive->GetComponentRotation());
+	CarouselUpdateIntervals.Add(1);
+	CarouselUseKinematicTarget.Add(Carousel->UseKinematicTarget);
+	if (Carousel->UseKinematicTarget) Primitive->SetUpdateKinematicFromSimulation(true);
+	RegisterSignificance(Carousel, Primitive, CAROUSEL_SIGNIFICANCE_TAG);
+}
+
+void UKinematicAnimationSubsystem::UnregisterCarousel(UCarouselComponent* Carousel) {
+	const int32 Index = Carousels.Find(Carousel);
+	if (Index == INDEX_NONE) return;
+
+	Carousels.RemoveAtSwap(Index, 1, false);
+	CarouselPrimitives.RemoveAtSwap(Index, 1, false);
+	CarouselSpinSpeeds.RemoveAtSwap(Index, 1, false);
+	CarouselRotations.RemoveAtSwap(Index, 1, false);
+	CarouselUpdateIntervals.RemoveAtSwap(Index, 1, false);
+	CarouselUseKinematicTarget.RemoveAtSwap(Index, 1, false);
+	UnregisterSignificance(Carousel);
+}
+
+void UKinematicAnimationSubsystem::RegisterElevator(UElevatorComponent* Elevator, UPrimitiveComponent* Primitive) {
+	LLM_SCOPE_BYTAG(Sandbox_Animation);
+	if (!Elevator || !Primitive || Elevators.Contains(Elevator)) return;
+
+	Elevators.Add(Elevator);
+	ElevatorPrimitives.Add(Primitive);
+	ElevatorCycleTimes.Add(Elevator->CycleTime);
+	ElevatorCycleHeights.Add(Elevator->CycleHeight);
+	ElevatorCycleUpward.Add(Elevator->CycleUpward);
+	ElevatorStartLocations.Add(Primitive->GetComponentLocation());
+	ElevatorLocations.Add(Primitive->GetComponentLocation());
+	ElevatorUpdateIntervals.Add(1);
+	ElevatorUseKinematicTarget.Add(Elevator->UseKinematicTarget);
+	if (Elevator->UseKinematicTarget) Primitive->SetUpdateKinematicFromSimulation(true);
+	RegisterSignificance(Elevator, Primitive, ELEVATOR_SIGNIFICANCE_TAG);
+}
+
+void UKinematicAnimationSubsystem::UnregisterElevator(UElevatorComponent* Elevator) {
+	const int32 Index = Elevators.Find(Elevator);
+	if (Index == INDEX_NONE) return;
+
+	Elevators.RemoveAtSwap(Index, 1, false);
+	ElevatorPrimitives.RemoveAtSwap(Index, 1, false);
+	ElevatorCycleTimes.RemoveAtSwap(Index, 1, false);
+	ElevatorCycleHeights.RemoveAtSwap(Index, 1, false);
+	ElevatorCycleUpward.RemoveAtSwap(Index, 1, false);
+	ElevatorStartLocations.RemoveAtSwap(Index, 1, false);
+	ElevatorLocations.RemoveAtSwap(Index, 1, false);
+	ElevatorUpdateIntervals.RemoveAtSwap(Index, 1, false);
+	ElevatorUseKinematicTarget.RemoveAtSwap(Index, 1, false);
+	UnregisterSignificance(Elevator);
+}
+
+void UKinematicAnimationSubsystem::RegisterInstancedPlatform(AInstancedPlatformActor* InstancedPlatform) {
+	LLM_SCOPE_BYTAG(Sandbox_Animation);
+	if (!InstancedPlatform || !InstancedPlatform->InstancedMesh || InstancedPlatforms.Contains(InstancedPlatform)) return;
+
+	InstancedPlatforms.Add(InstancedPlatform);
+	InstancedPlatformUpdateIntervals.Add(1);
+	RegisterSignificance(InstancedPlatform, InstancedPlatform->InstancedMesh, INSTANCED_PLATFORM_SIGNIFICANCE_TAG);
+}
+
+void UKinematicAnimationSubsystem::UnregisterInstancedPlatform(AInstancedPlatformActor* InstancedPlatform) {
+	const int32 Index = InstancedPlatforms.Find(InstancedPlatform);
+	if (Index == INDEX_NONE) return;
+
+	InstancedPlatforms.RemoveAtSwap(Index, 1, false);
+	InstancedPlatformUpdateIntervals.RemoveAtSwap(Index, 1, false);
+	UnregisterSignificance(InstancedPlatform);
+}
+
+void UKinematicAnimationSubsystem::GetAnimatedPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const {
+	OutPrimitives.Reset(CarouselPrimitives.Num() + ElevatorPrimitives.Num());
+	OutPrimitives.Append(CarouselPrimitives);
+	OutPrimitives.Append(ElevatorPrimitives);
+}
+
+
+/*--- Animation Functions ---*/
+
+double UKinematicAnimationSubsystem::GetAnimationTime() const {
+	const UWorld* World = GetWorld();
+	const AGameStateBase* GameState = World->GetGameState();
+	return GameState ? GameState->GetServerWorldTimeSeconds() : World->GetTimeSeconds();
+}
+
+void UKinematicAnimationSubsystem::RefreshAnimatorParameters() {
+
+	// Blueprints Can Change These at Any Time, So They're Picked Up Every Frame
+	for (int32 Index = 0; Index < Carousels.Num(); Index++) {
+		if (const UCarouselComponent* Carousel = Carousels[Index]) CarouselSpinSpeeds[Index] = Carousel->SpinSpeed;
+	}
+
+	for (int32 Index = 0; Index < Elevators.Num(); Index++) {
+		const UElevatorComponent* Elevator = Elevators[Index];
+		if (!Elevator) continue;
+
+		ElevatorCycleTimes[Index] = Elevator->CycleTime;
+		ElevatorCycleHeights[Index] = Elevator->CycleHeight;
+		ElevatorCycleUpward[Index] = Elevator->CycleUpward;
+	}
+}
+
+void UKinematicAnimationSubsystem::EvaluateAnimators(double AnimationTime, double TargetLeadTime) {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UKinematicAnimationSubsystem::EvaluateAnimators);
+	const int32 CarouselCount = Carousels.Num();
+	const int32 AnimatorCount = CarouselCount + Elevators.Num();
+
+	// Evaluate Every Pose Across Worker Threads (Plain Data Only)
+	ParallelFor(
+		AnimatorCount,
+		[this, CarouselCount, AnimationTime, TargetLeadTime](int32 Index) {
+			if (Index < CarouselCount) {
+				if (!ShouldUpdateAnimator(CarouselUpdateIntervals[Index], Index)) return;
+				const double Time = CarouselUseKinematicTarget[Index] ? AnimationTime + TargetLeadTime : AnimationTime;
+				CarouselRotations[Index] = UCarouselComponent::EvaluateRotation(CarouselSpinSpeeds[Index], Time);
+			}
+			else {
+				const int32 ElevatorIndex = Index - CarouselCount;
+				if (!ShouldUpdateAnimator(ElevatorUpdateIntervals[ElevatorIndex], Index)) return;
+				const double Time = ElevatorUseKinematicTarget[ElevatorIndex] ? AnimationTime + TargetLeadTime : AnimationTime;
+				ElevatorLocations[ElevatorIndex] = UElevatorComponent::EvaluateLocation(
+					ElevatorStartLocations[ElevatorIndex],
+					ElevatorCycleTimes[ElevatorIndex],
+					ElevatorCycleHeights[ElevatorIndex],
+					ElevatorCycleUpward[ElevatorIndex],
+					Time
+				);
+			}
+		},
+		AnimatorCount < MIN_ANIMATORS_PER_WORKER ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None
+	);
+}
+
+void UKinematicAnimationSubsystem::ApplyAnimators() {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UKinematicAnimationSubsystem::ApplyAnimators);
+
+	// Apply Poses on Game Thread (No Sweeps, No Physics Teleport)
+	const int32 CarouselCount = CarouselPrimitives.Num();
+	for (int32 Index = 0; Index < CarouselCount; Index++) {
+		UPrimitiveComponent* Primitive = CarouselPrimitives[Index];
+		if (!Primitive || !ShouldUpdateAnimator(CarouselUpdateIntervals[Index], Index)) continue;
+
+		if (CarouselUseKinematicTarget[Index]) {
+			FTransform Target = Primitive->GetComponentTransform();
+			Target.SetRotation(CarouselRotations[Index].Quaternion());
+			ApplyKinematicTarget(Primitive, Target);
+		}
+		else {
+			Primitive->SetWorldRotation(CarouselRotations[Index], false, nullptr, ETeleportType::None);
+		}
+	}
+
+	for (int32 Index = 0; Index < ElevatorPrimitives.Num(); Index++) {
+		UPrimitiveComponent* Primitive = ElevatorPrimitives[Index];
+		if (!Primitive || !ShouldUpdateAnimator(ElevatorUpdateIntervals[Index], CarouselCount + Index)) continue;
+
+		if (ElevatorUseKinematicTarget[Index]) {
+			FTransform Target = Primitive->GetComponentTransform();
+			Target.SetLocation(ElevatorLocations[Index]);
+			ApplyKinematicTarget(Primitive, Target);
+		}
+		else {
+			Primitive->SetWorldLocation(ElevatorLocations[Index], false, nullptr, ETeleportType::None);
+		}
+	}
+}
+
+void UKinematicAnimationSubsystem::UpdateInstancedPlatforms(double AnimationTime) {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UKinematicAnimationSubsystem::UpdateInstancedPlatforms);
+	const int32 FirstIndex = Carousels.Num() + Elevators.Num();
+
+	// Each Platform Batches Its Own Instances
+	for (int32 Index = 0; Index < InstancedPlatforms.Num(); Index++) {
+		AInstancedPlatformActor* InstancedPlatform = InstancedPlatforms[Index];
+		if (InstancedPlatform && ShouldUpdateAnimator(InstancedPlatformUpdateIntervals[Index], FirstIndex + Index)) {
+			InstancedPlatform->UpdateInstances(AnimationTime);
+		}
+	}
+}
+
+void UKinematicAnimationSubsystem::ApplyKinematicTarget(UPrimitiveComponent* Primitive, const FTransform& Target) const {
+	FBodyInstance* BodyInstance = Primitive->GetBodyInstance();
+
+	// Non-Teleport Body Moves Become Kinematic Targets, Reached Over the Next Physics Step
+	if (BodyInstance && BodyInstance->IsValidBodyInstance() && !BodyInstance->IsInstanceSimulatingPhysics()) {
+		BodyInstance->SetBodyTransform(Target, ETeleportType::None);
+	}
+	else {
+		Primitive->SetWorldTransform(Target, false, nullptr, ETeleportType::None);
+	}
+}
+
+bool UKinematicAnimationSubsystem::ShouldUpdateAnimator(uint8 UpdateInterval, int32 Index) const {
+
+	// Stagger by Index So Reduced Animators Don't All Land on the Same Frame
+	return UpdateInterval != 0 && (GFrameCounter + Index) % UpdateInterval == 0;
+}
+
+
+/*--- Significance Functions ---*/
+
+void UKinematicAnimationSubsystem::RegisterSignificance(UObject* Animator, UPrimitiveComponent* Primitive, FName Tag) {
+	LLM_SCOPE_BYTAG(Sandbox_Animation);
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (!SignificanceManager) return;
+
+	SignificanceManager->RegisterObject(
+		Animator,
+		Tag,
+		[this, Primitive](USignificanceManager::FManagedObjectInfo* ObjectInfo, const FTransform& Viewpoint) {
+			return CalculateSignificance(Primitive, Viewpoint);
+		}
+	);
+}
+
+void UKinematicAnimationSubsystem::UnregisterSignificance(UObject* Animator) {
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(GetWorld());
+	if (SignificanceManager) SignificanceManager->UnregisterObject(Animator);
+}
+
+void UKinematicAnimationSubsystem::UpdateSignificance() {
+	TRACE_CPUPROFILER_EVENT_SCOPE(UKinematicAnimationSubsystem::UpdateSignificance);
+	UWorld* World = GetWorld();
+	USignificanceManager* SignificanceManager = USignificanceManager::Get(World);
+	if (!SignificanceManager) return;
+
+	// Gather Riders and Viewpoints (Every Player on the Server, Local Players on Clients)
+	RiddenPrimitives.Reset();
+	Viewpoints.Reset();
+	for (FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator) {
+		APlayerController* PlayerController = Iterator->Get();
+		if (!PlayerController) continue;
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		Viewpoints.Add(FTransform(ViewRotation, ViewLocation));
+
+		const ACharacter* Character = Cast<ACharacter>(PlayerController->GetPawn());
+		if (Character && Character->GetMovementBase()) {
+			RiddenPrimitives.Add(Character->GetMovementBase());
+		}
+	}
+
+	// Only Standalone and Clients Render What Their Players See
+	const ENetMode NetMode = World->GetNetMode();
+	UseVisibility = NetMode == NM_Standalone || NetMode == NM_Client;
+
+	SignificanceManager->Update(Viewpoints);
+
+	for (int32 Index = 0; Index < Carousels.Num(); Index++) {
+		CarouselUpdateIntervals[Index] = GetUpdateInterval(SignificanceManager->GetSignificance(Carousels[Index]));
+	}
+
+	for (int32 Index = 0; Index < Elevators.Num(); Index++) {
+		ElevatorUpdateIntervals[Index] = GetUpdateInterval(SignificanceManager->GetSignificance(Elevators[Index]));
+	}
+
+	for (int32 Index = 0; Index < InstancedPlatforms.Num(); Index++) {
+		InstancedPlatformUpdateIntervals[Index] = GetUpdateInterval(SignificanceManager->GetSignificance(InstancedPlatforms[Index]));
+	}
+}
+
+float UKinematicAnimationSubsystem::CalculateSignificance(const UPrimitiveComponent* Primitive, const FTransform& Viewpoint) const {
+	if (!Primitive) return SIGNIFICANCE_NONE;
+
+	// Anything Carrying a Player Runs at Full Rate
+	if (RiddenPrimitives.Contains(Primitive)) return SIGNIFICANCE_RIDDEN;
+
+	// Measure to the Bounds, Not the Origin, So Large Instanced Platforms Score Fairly
+	const float DistanceSquared = Primitive->Bounds.ComputeSquaredDistanceFromBoxToPoint(Viewpoint.GetLocation());
+	const bool IsNear = DistanceSquared < FMath::Square(FULL_RATE_DISTANCE);
+	const bool IsVisible = !UseVisibility || Primitive->WasRecentlyRendered(VISIBILITY_TOLERANCE);
+
+	if (IsVisible && IsNear) return SIGNIFICANCE_NEAR;
+
+	// Keep Hidden Animators Close By Moving, a Player Could Step Onto Them
+	if (IsNear || (IsVisible && DistanceSquared < FMath::Square(REDUCED_RATE_DISTANCE))) return SIGNIFICANCE_REDUCED;
+
+	return SIGNIFICANCE_NONE;
+}
+
+uint8 UKinematicAnimationSubsystem::GetUpdateInterval(float Significance) const {
+	if (Significance >= SIGNIFICANCE_NEAR) return 1;
+	if (Significance >= SIGNIFICANCE_REDUCED) return REDUCED_UPDATE_INTERVAL;
+	return 0;
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "KinematicAnimationSubsystem.generated.h"
+
+class AInstancedPlatformActor;
+class UCarouselComponent;
+class UElevatorComponent;
+class UPrimitiveComponent;
+
+/*
+ *  KinematicAnimationSubsystem.h                     Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for KinematicAnimationSubsystem.cpp.
+ */
+
+UCLASS()
+class SANDBOX_API UKinematicAnimationSubsystem : public UTickableWorldSubsystem {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	// Below this many animators, worker dispatch costs more than it saves.
+	private: const int32 MIN_ANIMATORS_PER_WORKER = 64;
+
+	// Significance Levels (Higher Updates More Often)
+	private: const float SIGNIFICANCE_RIDDEN = 3.0f;
+	private: const float SIGNIFICANCE_NEAR = 2.0f;
+	private: const float SIGNIFICANCE_REDUCED = 1.0f;
+	private: const float SIGNIFICANCE_NONE = 0.0f;
+
+	private: const float FULL_RATE_DISTANCE = 3000.0f;
+	private: const float REDUCED_RATE_DISTANCE = 10000.0f;
+	private: const uint8 REDUCED_UPDATE_INTERVAL = 4;
+	private: const float VISIBILITY_TOLERANCE = 0.25f;
+
+	private: const FName CAROUSEL_SIGNIFICANCE_TAG = FName(TEXT("Carousel"));
+	private: const FName ELEVATOR_SIGNIFICANCE_TAG = FName(TEXT("Elevator"));
+	private: const FName INSTANCED_PLATFORM_SIGNIFICANCE_TAG = FName(TEXT("InstancedPlatform"));
+
+
+	/*--- Variables ---*/
+
+	// Carousels (Parallel Arrays, One Entry per Registered Component)
+	private: UPROPERTY() TArray<UCarouselComponent*> Carousels;
+	private: UPROPERTY() TArray<UPrimitiveComponent*> CarouselPrimitives;
+	private: TArray<float> CarouselSpinSpeeds;
+	private: TArray<FRotator> CarouselRotations;
+	private: TArray<uint8> CarouselUpdateIntervals;
+	private: TArray<bool> CarouselUseKinematicTarget;
+
+	// Elevators (Parallel Arrays, One Entry per Registered Component)
+	private: UPROPERTY() TArray<UElevatorComponent*> Elevators;
+	private: UPROPERTY() TArray<UPrimitiveComponent*> ElevatorPrimitives;
+	private: TArray<float> ElevatorCycleTimes;
+	private: TArray<float> ElevatorCycleHeights;
+	private: TArray<bool> ElevatorCycleUpward;
+	private: TArray<FVector> ElevatorStartLocations;
+	private: TArray<FVector> ElevatorLocations;
+	private: TArray<uint8> ElevatorUpdateIntervals;
+	private: TArray<bool> ElevatorUseKinematicTarget;
+
+	// Instanced Platforms (Each Entry Animates All of an Actor's Instances)
+	private: UPROPERTY() TArray<AInstancedPlatformActor*> InstancedPlatforms;
+	private: TArray<uint8> InstancedPlatformUpdateIntervals;
+
+	// Significance (Rebuilt Every Frame Before the Significance Update)
+	private: TSet<const UPrimitiveComponent*> RiddenPrimitives;
+	private: TArray<FTransform> Viewpoints;
+	private: bool UseVisibility = true;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: virtual void Tick(float DeltaTime) override;
+
+	public: virtual TStatId GetStatId() const override;
+
+	public: virtual void Deinitialize() override;
+
+	protected: virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+
+	/*--- Registration Functions ---*/
+
+	/** Starts animating the carousel's primitive. The spin is phased to the shared animation time. **/
+	public: void RegisterCarousel(UCarouselComponent* Carousel, UPrimitiveComponent* Primitive);
+
+	public: void UnregisterCarousel(UCarouselComponent* Carousel);
+
+	/** Starts animating the elevator's primitive from its current location. **/
+	public: void RegisterElevator(UElevatorComponent* Elevator, UPrimitiveComponent* Primitive);
+
+	public: void UnregisterElevator(UElevatorComponent* Elevator);
+
+	/** Starts animating every instance of the platform actor as one significance managed unit. **/
+	public: void RegisterInstancedPlatform(AInstancedPlatformActor* InstancedPlatform);
+
+	public: void UnregisterInstancedPlatform(AInstancedPlatformActor* InstancedPlatform);
+
+	/** Primitives of every registered carousel and elevator, e.g. for bots looking for a ride. **/
+	public: void GetAnimatedPrimitives(TArray<UPrimitiveComponent*>& OutPrimitives) const;
+
+
+	/*--- Animation Functions ---*/
+
+	/** Seconds of replicated server world time, identical on every machine once the game state
+	 *  has synced. Falls back to local world time before that (and in standalone games).
+	 */
+	public: double GetAnimationTime() const;
+
+	/** Copies each component's animation parameters into the contiguous arrays (Game Thread). **/
+	private: void RefreshAnimatorParameters();
+
+	/** Kinematic target animators are evaluated TargetLeadTime ahead, since the physics step that
+	 *  carries them to their target runs during the next frame.
+	 */
+	private: void EvaluateAnimators(double AnimationTime, double TargetLeadTime);
+
+	private: void ApplyAnimators();
+
+	private: void UpdateInstancedPlatforms(double AnimationTime);
+
+	private: void ApplyKinematicTarget(UPrimitiveComponent* Primitive, const FTransform& Target) const;
+
+	/** An interval of N updates the animator every Nth frame, and zero leaves it where it is. **/
+	private: bool ShouldUpdateAnimator(uint8 UpdateInterval, int32 Index) const;
+
+
+	/*--- Significance Functions ---*/
+
+	private: void RegisterSignificance(UObject* Animator, UPrimitiveComponent* Primitive, FName Tag);
+
+	private: void UnregisterSignificance(UObject* Animator);
+
+	/** Refreshes riders and viewpoints, runs the significance manager, then maps each animator's
+	 *  significance onto an update interval.
+	 */
+	private: void UpdateSignificance();
+
+	private: float CalculateSignificance(const UPrimitiveComponent* Primitive, const FTransform& Viewpoint) const;
+
+	private: uint8 GetUpdateInterval(float Significance) const;
+
+};
@@ -9,17 +9,36 @@ public class Sandbox : ModuleRules
 	{
 		PCHUsage = PCHUsageMode.UseExplicitOrSharedPCHs;
 	
-		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "HeadMountedDisplay", "Steamworks" });
+		PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "HeadMountedDisplay", "Steamworks", "SignificanceManager" });
 
-		PrivateDependencyModuleNames.AddRange(new string[] {  });
+		PrivateDependencyModuleNames.AddRange(new string[] { "AdvancedSteamSessions", "Json", "OnlineSubsystem", "OnlineSubsystemUtils", "PakFile" });
 
-		PublicAdditionalLibraries.Add(Path.Combine(ModuleDirectory, "Dependencies", "Steam", "Library", "steam_api64.lib"));
+		// Steam Client Library (Sign In & Steam Input, Never Needed by Dedicated Servers)
+		bool bWithSandboxSteam = false;
+		string SteamLibraryPath = Path.Combine(ModuleDirectory, "Dependencies", "Steam", "Library");
+
+		if (Target.Type != TargetType.Server)
+		{
+			if (Target.Platform == UnrealTargetPlatform.Win64)
+			{
+				PublicAdditionalLibraries.Add(Path.Combine(SteamLibraryPath, "steam_api64.lib"));
+				bWithSandboxSteam = true;
+			}
+			else if (Target.Platform == UnrealTargetPlatform.Linux)
+			{
+				// Copy libsteam_api.so From the Steamworks SDK Here, Otherwise the Stub Backend Is Built
+				string SteamSharedLibrary = Path.Combine(SteamLibraryPath, "Linux64", "libsteam_api.so");
+				if (File.Exists(SteamSharedLibrary))
+				{
+					PublicAdditionalLibraries.Add(SteamSharedLibrary);
+					RuntimeDependencies.Add("$(TargetOutputDir)/libsteam_api.so", SteamSharedLibrary);
+					bWithSandboxSteam = true;
+				}
+			}
+		}
+
+		PublicDefinitions.Add("WITH_SANDBOX_STEAM=" + (bWithSandboxSteam ? "1" : "0"));
 		
 		PublicIncludePaths.Add("Sandbox");
-		
-		// Uncomment if you are using online features
-		// PrivateDependencyModuleNames.Add("OnlineSubsystem");
-		// To include OnlineSubsystemSteam, add it to the plugins
-		// section in your uproject file with the Enabled attribute set to true
 	}
 }
@@ -1,6 +1,37 @@
 // Fill out your copyright notice in the Description page of Project Settings.
 
 #include "Sandbox.h"
+#include "AllLevels/Utility/SandboxLog.h"
+#include "AllLevels/Utility/SandboxMemory.h"
+#include "AllLevels/Utility/SandboxTimeline.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, Sandbox, "Sandbox" );
+IMPLEMENT_PRIMARY_GAME_MODULE( FSandboxModule, Sandbox, "Sandbox" );
+
+/*
+ *  Sandbox.cpp                                       Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    FSandboxModule is the game module. It starts the binary log, the
+ *  timeline and the memory snapshots as early as game code can run,
+ *  so engine init and the first map load are recorded too.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+void FSandboxModule::StartupModule() {
+	FDefaultGameModuleImpl::StartupModule();
+
+	FSandboxLog::Get().Start();
+	FSandboxTimeline::Get().Start();
+	FSandboxMemory::Get().Start();
+}
+
+void FSandboxModule::ShutdownModule() {
+	FSandboxMemory::Get().Stop();
+	FSandboxTimeline::Get().Stop();
+	FSandboxLog::Get().Shutdown();
+
+	FDefaultGameModuleImpl::ShutdownModule();
+}
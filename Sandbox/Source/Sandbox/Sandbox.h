@@ -3,4 +3,21 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Modules/ModuleManager.h"
 
+/*
+ *  Sandbox.h                                         Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for Sandbox.cpp.
+ */
+
+class FSandboxModule : public FDefaultGameModuleImpl {
+
+	/*--- Lifecycle Functions ---*/
+
+	public: virtual void StartupModule() override;
+
+	public: virtual void ShutdownModule() override;
+
+};
@@ -0,0 +1,52 @@
+
+#include "ThirdPersonAnimInstance.h"
+#include "AllLevels/Utility/SandboxMemory.h"
+#include "AllLevels/Utility/SandboxStats.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+/*
+ *  ThirdPersonAnimInstance.cpp                       Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    ThirdPersonAnimInstance is the native parent of ThirdPerson_AnimBP.
+ *  The game thread only copies the movement component's state, and
+ *  everything the anim graph reads is derived from that copy in the
+ *  thread safe update, which runs alongside every other character's
+ *  on the worker threads. The anim graph should read these values
+ *  directly (or through property access), keeping its event graph
+ *  empty so the Blueprint doesn't force a game thread update.
+ *
+ *  Note: How often this runs is throttled per character by update
+ *        rate optimization, see ThirdPersonCharacter.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+void UThirdPersonAnimInstance::NativeInitializeAnimation() {
+	Super::NativeInitializeAnimation();
+
+	const ACharacter* Character = Cast<ACharacter>(TryGetPawnOwner());
+	MovementComponent = Character ? Character->GetCharacterMovement() : nullptr;
+}
+
+void UThirdPersonAnimInstance::NativeUpdateAnimation(float DeltaSeconds) {
+	Super::NativeUpdateAnimation(DeltaSeconds);
+	if (!MovementComponent) return;
+
+	MovementVelocity = MovementComponent->Velocity;
+	MovementAcceleration = MovementComponent->GetCurrentAcceleration();
+	IsMovementFalling = MovementComponent->IsFalling();
+}
+
+void UThirdPersonAnimInstance::NativeThreadSafeUpdateAnimation(float DeltaSeconds) {
+	Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
+	SANDBOX_SCOPE(CharacterAnimation);
+	LLM_SCOPE_BYTAG(Sandbox_Animation);
+
+	Velocity = MovementVelocity;
+	GroundSpeed = Velocity.Size2D();
+	ShouldMove = GroundSpeed > MIN_MOVE_SPEED && !MovementAcceleration.IsNearlyZero();
+	IsFalling = IsMovementFalling;
+}
@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Animation/AnimInstance.h"
+#include "ThirdPersonAnimInstance.generated.h"
+
+class UCharacterMovementComponent;
+
+/*
+ *  ThirdPersonAnimInstance.h                         Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for ThirdPersonAnimInstance.cpp.
+ */
+
+UCLASS(Blueprintable, Transient)
+class SANDBOX_API UThirdPersonAnimInstance : public UAnimInstance {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	// Below This Ground Speed, or Without Acceleration, the Character Idles
+	private: const float MIN_MOVE_SPEED = 3.0f;
+
+
+	/*--- Variables ---*/
+
+	// Read by the Anim Graph (Only Written During the Thread Safe Update)
+	public: UPROPERTY(BlueprintReadOnly, Category=Movement)
+	FVector Velocity = FVector::ZeroVector;
+
+	public: UPROPERTY(BlueprintReadOnly, Category=Movement)
+	float GroundSpeed = 0.0f;
+
+	public: UPROPERTY(BlueprintReadOnly, Category=Movement)
+	bool ShouldMove = false;
+
+	public: UPROPERTY(BlueprintReadOnly, Category=Movement)
+	bool IsFalling = false;
+
+	private: UPROPERTY()
+	UCharacterMovementComponent* MovementComponent = nullptr;
+
+	// Copied on the Game Thread, So the Worker Update Never Touches the Movement Component
+	private: FVector MovementVelocity = FVector::ZeroVector;
+	private: FVector MovementAcceleration = FVector::ZeroVector;
+	private: bool IsMovementFalling = false;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	protected: virtual void NativeInitializeAnimation() override;
+
+	protected: virtual void NativeUpdateAnimation(float DeltaSeconds) override;
+
+	/** Runs on a worker thread during the parallel anim update (Or on the Game Thread When It Is Off). **/
+	protected: virtual void NativeThreadSafeUpdateAnimation(float DeltaSeconds) override;
+
+};
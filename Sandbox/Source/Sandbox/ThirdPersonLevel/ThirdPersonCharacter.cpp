@@ -0,0 +1,137 @@
+
+#include "ThirdPersonCharacter.h"
+#include "AllLevels/Input/GamepadLookAdapter.h"
+#include "Camera/CameraComponent.h"
+#include "Components/CapsuleComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/Controller.h"
+#include "GameFramework/SpringArmComponent.h"
+
+/*
+ *  ThirdPersonCharacter.cpp                          Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *    ThirdPersonCharacter is the base character class of the third
+ *  person levels of Sandbox. It turns toward its movement, with a
+ *  boom camera orbiting it, and gets its input from InputCharacter
+ *  like the first person characters do.
+ *
+ *  Animation Budget
+ *    - The mesh's anim instance (ThirdPersonAnimInstance) updates on
+ *      the worker threads.
+ *    - Every character other than the local player's own uses update
+ *      rate optimization: smaller on screen means fewer evaluations
+ *      (interpolated in between), offscreen means far fewer, and
+ *      only montages keep ticking while unrendered.
+ *
+ *  Note: a.URO.Draw 1 tints each mesh by its current update rate.
+ */
+
+
+/*--- Lifecycle Functions ---*/
+
+AThirdPersonCharacter::AThirdPersonCharacter(const FObjectInitializer& ObjectInitializer) : Super(ObjectInitializer) {
+
+	// Setup Capsule & Mesh (Mannequin Faces +Y, Feet at the Capsule's Bottom)
+	GetCapsuleComponent()->InitCapsuleSize(DEFAULT_CAPSULE_RADIUS, DEFAULT_CAPSULE_HEIGHT);
+	GetMesh()->SetRelativeLocationAndRotation(FVector(0.0f, 0.0f, -DEFAULT_CAPSULE_HEIGHT), FRotator(0.0f, -90.0f, 0.0f));
+
+	// Turn Toward Movement, Not the Camera
+	bUseControllerRotationPitch = false;
+	bUseControllerRotationYaw = false;
+	bUseControllerRotationRoll = false;
+
+	// Configure Movement
+	GetCharacterMovement()->bOrientRotationToMovement = true;
+	GetCharacterMovement()->RotationRate = FRotator(0.0f, DEFAULT_TURN_RATE, 0.0f);
+	GetCharacterMovement()->JumpZVelocity = DEFAULT_JUMP_VELOCITY;
+	GetCharacterMovement()->AirControl = DEFAULT_AIR_CONTROL;
+	GetCharacterMovement()->MaxWalkSpeed = DEFAULT_WALK_SPEED;
+
+	// Setup Camera
+	CameraBoom = CreateDefaultSubobject<USpringArmComponent>(TEXT("CameraBoom"));
+	CameraBoom->SetupAttachment(GetRootComponent());
+	CameraBoom->TargetArmLength = CAMERA_DISTANCE;
+	CameraBoom->bUsePawnControlRotation = true;
+	FollowCamera = CreateDefaultSubobject<UCameraComponent>(TEXT("FollowCamera"));
+	FollowCamera->SetupAttachment(CameraBoom, USpringArmComponent::SocketName);
+	FollowCamera->bUsePawnControlRotation = false;
+
+	// Throttled Until a Local Player Takes Control
+	GetMesh()->bEnableUpdateRateOptimizations = true;
+	GetMesh()->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+
+	// Bound Before the Mesh Registers, Which Creates the Parameters (Ahead of BeginPlay)
+	GetMesh()->OnAnimUpdateRateParamsCreated.BindUObject(this, &AThirdPersonCharacter::OnAnimUpdateRateParamsCreated);
+}
+
+void AThirdPersonCharacter::BeginPlay() {
+	Super::BeginPlay();
+
+	GamepadLookAdapter = NewObject<UGamepadLookAdapter>(this);
+	UpdateAnimationRate();
+}
+
+void AThirdPersonCharacter::NotifyControllerChanged() {
+	Super::NotifyControllerChanged();
+
+	UpdateAnimationRate();
+}
+
+
+/*--- Animation Functions ---*/
+
+void AThirdPersonCharacter::UpdateAnimationRate() {
+	const bool IsLocalPlayer = IsLocallyControlled() && IsPlayerControlled();
+
+	GetMesh()->bEnableUpdateRateOptimizations = !IsLocalPlayer;
+	GetMesh()->VisibilityBasedAnimTickOption = IsLocalPlayer
+		? EVisibilityBasedAnimTickOption::AlwaysTickPoseAndRefreshBones
+		: EVisibilityBasedAnimTickOption::OnlyTickMontagesWhenNotRendered;
+}
+
+void AThirdPersonCharacter::OnAnimUpdateRateParamsCreated(FAnimUpdateRateParameters* Parameters) {
+	Parameters->BaseVisibleDistanceFactorThesholds = TArray<float>(URO_SCREEN_SIZE_THRESHOLDS, UE_ARRAY_COUNT(URO_SCREEN_SIZE_THRESHOLDS));
+	Parameters->BaseNonRenderedUpdateRate = URO_OFFSCREEN_UPDATE_RATE;
+	Parameters->MaxEvalRateForInterpolation = URO_MAX_INTERPOLATED_RATE;
+}
+
+
+/*--- Input Handling Overrides ---*/
+
+void AThirdPersonCharacter::OnMouseHorizontal(float Input) {
+	AddControllerYawInput(Input);
+}
+
+void AThirdPersonCharacter::OnMouseVertical(float Input) {
+	AddControllerPitchInput(Input);
+}
+
+void AThirdPersonCharacter::OnStickLeft(FVector2D Input) {
+	AInputCharacter::OnStickLeft(Input);
+	if (!Controller) return;
+
+	// Move Relative to Where the Camera Faces
+	const FRotator YawRotation(0.0f, Controller->GetControlRotation().Yaw, 0.0f);
+	AddMovementInput(FRotationMatrix(YawRotation).GetUnitAxis(EAxis::X), Input.Y);
+	AddMovementInput(FRotationMatrix(YawRotation).GetUnitAxis(EAxis::Y), Input.X);
+}
+
+void AThirdPersonCharacter::OnStickRight(FVector2D Input) {
+	AInputCharacter::OnStickRight(Input);
+
+	FVector2D Rotation = GamepadLookAdapter->calculatePlayerRotation(Input, GetWorld()->GetDeltaSeconds());
+	AddControllerYawInput(Rotation.X);
+	AddControllerPitchInput(Rotation.Y);
+}
+
+void AThirdPersonCharacter::OnFaceBottomPress() {
+	AInputCharacter::OnFaceBottomPress();
+	Jump();
+}
+
+void AThirdPersonCharacter::OnFaceBottomRelease() {
+	AInputCharacter::OnFaceBottomRelease();
+	StopJumping();
+}
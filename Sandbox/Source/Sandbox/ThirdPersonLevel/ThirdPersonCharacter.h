@@ -0,0 +1,88 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AllLevels/Character/InputCharacter.h"
+#include "ThirdPersonCharacter.generated.h"
+
+class UCameraComponent;
+class UGamepadLookAdapter;
+class USpringArmComponent;
+struct FAnimUpdateRateParameters;
+
+/*
+ *  ThirdPersonCharacter.h                            Chris Cruzen
+ *  Sandbox                                             10.19.2026
+ *
+ *  Header file for ThirdPersonCharacter.cpp.
+ */
+
+UCLASS(Blueprintable, config=Game)
+class SANDBOX_API AThirdPersonCharacter : public AInputCharacter {
+
+	GENERATED_BODY()
+
+
+	/*--- Constants ---*/
+
+	private: const float DEFAULT_CAPSULE_HEIGHT = 96.0f;
+	private: const float DEFAULT_CAPSULE_RADIUS = 42.0f;
+
+	private: const float DEFAULT_JUMP_VELOCITY = 700.0f;
+	private: const float DEFAULT_AIR_CONTROL = 0.35f;
+	private: const float DEFAULT_WALK_SPEED = 500.0f;
+	private: const float DEFAULT_TURN_RATE = 500.0f;
+
+	private: const float CAMERA_DISTANCE = 400.0f;
+
+	// Update Rate Optimization (Remote & Bot Characters Only)
+	// Screen Size Below Each Threshold Skips One More Frame Between Updates
+	private: static constexpr float URO_SCREEN_SIZE_THRESHOLDS[] = { 0.4f, 0.2f, 0.1f };
+	private: const int32 URO_OFFSCREEN_UPDATE_RATE = 8;
+	private: const int32 URO_MAX_INTERPOLATED_RATE = 4;
+
+
+	/*--- Variables ---*/
+
+	protected: UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category=Camera, meta = (AllowPrivateAccess = "true"))
+	USpringArmComponent* CameraBoom;
+
+	protected: UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category=Camera, meta = (AllowPrivateAccess = "true"))
+	UCameraComponent* FollowCamera;
+
+	protected: UPROPERTY()
+	UGamepadLookAdapter* GamepadLookAdapter;
+
+
+	/*--- Lifecycle Functions ---*/
+
+	public: AThirdPersonCharacter(const FObjectInitializer& ObjectInitializer);
+
+	protected: virtual void BeginPlay() override;
+
+	// APawn Override
+	public: virtual void NotifyControllerChanged() override;
+
+
+	/*--- Animation Functions ---*/
+
+	/** A local player's character always animates at full rate, everyone else's is throttled by distance & visibility. **/
+	protected: void UpdateAnimationRate();
+
+	private: void OnAnimUpdateRateParamsCreated(FAnimUpdateRateParameters* Parameters);
+
+
+	/*--- Input Handling Overrides ---*/
+
+	virtual void OnMouseHorizontal(float Input) override;
+
+	virtual void OnMouseVertical(float Input) override;
+
+	virtual void OnStickLeft(FVector2D Input) override;
+
+	virtual void OnStickRight(FVector2D Input) override;
+
+	virtual void OnFaceBottomPress() override;
+
+	virtual void OnFaceBottomRelease() override;
+
+};